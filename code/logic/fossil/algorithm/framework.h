@@ -28,5 +28,7 @@
 #include "shuffle.h"
 #include "search.h"
 #include "sort.h"
+#include "pqueue.h"
+#include "sketch.h"
 
 #endif /* FOSSIL_ALGORITHM_FRAMEWORK_H */
@@ -0,0 +1,275 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_ALGORITHM_PQUEUE_H
+#define FOSSIL_ALGORITHM_PQUEUE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ======================================================
+// Fossil Algorithm Priority Queue — Heap Interface
+// ======================================================
+
+/**
+ * @brief Opaque priority queue stored as a 4-ary heap.
+ *
+ * Elements are copied into the queue by value, using the same type
+ * identifiers as @ref fossil_algorithm_sort_exec. The order identifier sets
+ * the orientation: "asc" keeps the smallest element on top (min-queue),
+ * "desc" keeps the largest on top (max-queue).
+ *
+ * Every element receives a handle when it enters the queue. Handles stay
+ * valid until the element leaves the queue and are recycled afterwards, so
+ * callers can keep them in their own arrays to update keys later.
+ */
+typedef struct fossil_algorithm_pqueue fossil_algorithm_pqueue_t;
+
+/**
+ * @brief Returned for handles that do not refer to a queued element.
+ */
+#define FOSSIL_ALGORITHM_PQUEUE_NPOS ((size_t)-1)
+
+/**
+ * @brief Creates an empty priority queue.
+ *
+ * Example:
+ * @code
+ * fossil_algorithm_pqueue_t *pq = fossil_algorithm_pqueue_create("i32", "asc", 64);
+ * int32_t v = 7;
+ * fossil_algorithm_pqueue_push(pq, &v, NULL);
+ * fossil_algorithm_pqueue_pop(pq, &v, NULL);
+ * fossil_algorithm_pqueue_destroy(pq);
+ * @endcode
+ *
+ * @param type_id String identifier for data type (e.g., "i32", "f64", "cstr").
+ * @param order_id "asc" for a min-queue (default), "desc" for a max-queue.
+ * @param capacity Initial number of element slots (0 picks a small default).
+ * @return Pointer to the queue, or NULL for an unknown type or allocation failure.
+ */
+fossil_algorithm_pqueue_t *fossil_algorithm_pqueue_create(
+    const char *type_id,
+    const char *order_id,
+    size_t capacity
+);
+
+/**
+ * @brief Releases a queue and all of its storage. Accepts NULL.
+ */
+void fossil_algorithm_pqueue_destroy(fossil_algorithm_pqueue_t *pq);
+
+/**
+ * @brief Inserts one element.
+ *
+ * @param pq Queue to modify.
+ * @param elem Pointer to the element to copy in.
+ * @param handle Optional output for the element's handle.
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-4` on allocation failure
+ */
+int fossil_algorithm_pqueue_push(fossil_algorithm_pqueue_t *pq, const void *elem, size_t *handle);
+
+/**
+ * @brief Removes the top element.
+ *
+ * @param pq Queue to modify.
+ * @param out Optional output buffer for the removed element.
+ * @param handle Optional output for the handle the element had.
+ * @return `0` on success, `-1` for invalid input, `-2` if the queue is empty.
+ */
+int fossil_algorithm_pqueue_pop(fossil_algorithm_pqueue_t *pq, void *out, size_t *handle);
+
+/**
+ * @brief Reads the top element without removing it.
+ *
+ * @return `0` on success, `-1` for invalid input, `-2` if the queue is empty.
+ */
+int fossil_algorithm_pqueue_top(const fossil_algorithm_pqueue_t *pq, void *out, size_t *handle);
+
+/**
+ * @brief Replaces the top element with a new one in a single sift.
+ *
+ * Equivalent to pop followed by push, but does one sift-down instead of a
+ * sift-down and a sift-up, which is the common step of a k-way merge. The
+ * new element takes over the handle of the element it replaces.
+ *
+ * @param pq Queue to modify.
+ * @param elem Pointer to the element to copy in.
+ * @param out Optional output buffer for the replaced top element.
+ * @return `0` on success, `-1` for invalid input, `-2` if the queue is empty.
+ */
+int fossil_algorithm_pqueue_replace_top(fossil_algorithm_pqueue_t *pq, const void *elem, void *out);
+
+/**
+ * @brief Adds many elements at once and restores the heap in O(n).
+ *
+ * Elements are appended and the heap is rebuilt bottom-up, which is cheaper
+ * than pushing them one at a time.
+ *
+ * @param pq Queue to modify.
+ * @param elems Pointer to an array of @p count elements.
+ * @param count Number of elements to add.
+ * @param handles Optional array of @p count entries receiving each element's handle.
+ * @return `0` on success, `-1` for invalid input, `-4` on allocation failure.
+ */
+int fossil_algorithm_pqueue_heapify(
+    fossil_algorithm_pqueue_t *pq,
+    const void *elems,
+    size_t count,
+    size_t *handles
+);
+
+/**
+ * @brief Changes the key of a queued element (decrease-key / increase-key).
+ *
+ * The element moves up or down as needed, so this serves both as the
+ * classic decrease-key of a min-queue and as its opposite.
+ *
+ * @param pq Queue to modify.
+ * @param handle Handle returned when the element was inserted.
+ * @param elem Pointer to the new element value.
+ * @return `0` on success, `-1` for invalid input, `-3` for a stale or unknown handle.
+ */
+int fossil_algorithm_pqueue_update_key(fossil_algorithm_pqueue_t *pq, size_t handle, const void *elem);
+
+/**
+ * @brief Returns the number of queued elements (0 for NULL).
+ */
+size_t fossil_algorithm_pqueue_size(const fossil_algorithm_pqueue_t *pq);
+
+/**
+ * @brief Removes every element while keeping the allocated storage.
+ */
+void fossil_algorithm_pqueue_clear(fossil_algorithm_pqueue_t *pq);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+
+namespace fossil {
+
+    namespace algorithm {
+
+        /**
+         * @brief RAII wrapper for the Fossil priority queue.
+         *
+         * Owns a fossil_algorithm_pqueue_t and releases it on destruction.
+         * The queue is movable but not copyable. All methods forward to the C
+         * API and return its status codes unchanged.
+         */
+        class PriorityQueue
+        {
+        public:
+            /**
+             * @brief Creates a queue for the given type and orientation.
+             *
+             * @param type_id String identifier for data type (e.g., "i32", "f64", "cstr").
+             * @param order_id "asc" for a min-queue, "desc" for a max-queue.
+             * @param capacity Initial number of element slots.
+             */
+            explicit PriorityQueue(
+            const std::string &type_id,
+            const std::string &order_id = "asc",
+            size_t capacity = 0
+            ) : pq_(fossil_algorithm_pqueue_create(type_id.c_str(), order_id.c_str(), capacity)) {}
+
+            ~PriorityQueue() { fossil_algorithm_pqueue_destroy(pq_); }
+
+            PriorityQueue(const PriorityQueue &) = delete;
+            PriorityQueue &operator=(const PriorityQueue &) = delete;
+
+            PriorityQueue(PriorityQueue &&other) noexcept : pq_(other.pq_) { other.pq_ = nullptr; }
+
+            PriorityQueue &operator=(PriorityQueue &&other) noexcept {
+                if (this != &other) {
+                    fossil_algorithm_pqueue_destroy(pq_);
+                    pq_ = other.pq_;
+                    other.pq_ = nullptr;
+                }
+                return *this;
+            }
+
+            /** @brief True when the queue was created successfully. */
+            bool valid() const { return pq_ != nullptr; }
+
+            /** @brief Inserts an element; see fossil_algorithm_pqueue_push. */
+            int push(const void *elem, size_t *handle = nullptr) {
+                return fossil_algorithm_pqueue_push(pq_, elem, handle);
+            }
+
+            /** @brief Removes the top element; see fossil_algorithm_pqueue_pop. */
+            int pop(void *out = nullptr, size_t *handle = nullptr) {
+                return fossil_algorithm_pqueue_pop(pq_, out, handle);
+            }
+
+            /** @brief Reads the top element; see fossil_algorithm_pqueue_top. */
+            int top(void *out, size_t *handle = nullptr) const {
+                return fossil_algorithm_pqueue_top(pq_, out, handle);
+            }
+
+            /** @brief Replaces the top element; see fossil_algorithm_pqueue_replace_top. */
+            int replace_top(const void *elem, void *out = nullptr) {
+                return fossil_algorithm_pqueue_replace_top(pq_, elem, out);
+            }
+
+            /** @brief Bulk insert; see fossil_algorithm_pqueue_heapify. */
+            int heapify(const void *elems, size_t count, size_t *handles = nullptr) {
+                return fossil_algorithm_pqueue_heapify(pq_, elems, count, handles);
+            }
+
+            /** @brief Changes a queued key; see fossil_algorithm_pqueue_update_key. */
+            int update_key(size_t handle, const void *elem) {
+                return fossil_algorithm_pqueue_update_key(pq_, handle, elem);
+            }
+
+            /** @brief Number of queued elements. */
+            size_t size() const { return fossil_algorithm_pqueue_size(pq_); }
+
+            /** @brief True when no elements are queued. */
+            bool empty() const { return size() == 0; }
+
+            /** @brief Removes every element. */
+            void clear() { fossil_algorithm_pqueue_clear(pq_); }
+
+        private:
+            fossil_algorithm_pqueue_t *pq_;
+        };
+
+    } // namespace algorithm
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_ALGORITHM_PQUEUE_H */
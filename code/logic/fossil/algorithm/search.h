@@ -51,12 +51,18 @@ extern "C" {
  *
  * Limitations and notes for options:
  * - "binary", "jump", "exponential", "fibonacci": Require the array to be sorted
- *   according to the specified order ("asc" or "desc"). No runtime check is performed.
- * - "interpolation": Only supports sorted arrays of uniformly distributed integers
- *   (int32_t or int64_t). Returns -4 for unsupported types.
+ *   according to the specified order ("asc" or "desc"). No runtime check is performed;
+ *   use @ref fossil_algorithm_search_exec_checked to verify the order first.
+ * - "interpolation": Only supports sorted arrays of uniformly distributed integer
+ *   types ("i8" to "u64", "char", "bool", "size"). Returns -4 for floating-point
+ *   and other unsupported types. Falls back to bisection on skewed data.
  * - "linear": Works for any type and order, no sorting required.
+ * - "parallel": Linear search split across one worker per CPU; returns the
+ *   same lowest index as "linear". Small arrays run on the caller. See
+ *   @ref fossil_algorithm_search_parallel for explicit thread counts.
  * - If the type or algorithm is unknown or unsupported, returns -3 or -4.
- * - No runtime validation of array sorting or distribution is performed.
+ * - This entry point does not validate sorting or distribution; use
+ *   @ref fossil_algorithm_search_exec_checked for a sortedness check.
  *
  * The function returns the index of the found element, or a negative error code:
  *   - `-1` for not found
@@ -88,6 +94,33 @@ int fossil_algorithm_search_exec(
     const char *order_id
 );
 
+/**
+ * @brief @ref fossil_algorithm_search_exec with a sortedness check.
+ *
+ * Before an algorithm that assumes sorted input ("binary", "jump",
+ * "interpolation", "exponential", "fibonacci") runs, the array is verified
+ * with @ref fossil_algorithm_sort_is_sorted in @p order_id. The check is a
+ * linear scan, so this entry point is meant for debug builds, tests and
+ * untrusted input; "linear" and "auto" are not checked.
+ *
+ * @param base Pointer to the array to search.
+ * @param count Number of elements in the array.
+ * @param key Pointer to the key to search for.
+ * @param type_id String identifier for data type.
+ * @param algorithm_id String identifier for search algorithm.
+ * @param order_id String identifier for sort order ("asc", "desc").
+ * @return int As for @ref fossil_algorithm_search_exec, plus `-6` when the
+ *         algorithm needs sorted input and @p base is not sorted.
+ */
+int fossil_algorithm_search_exec_checked(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id
+);
+
 // ======================================================
 // Extended Utility API (optional future additions)
 // ======================================================
@@ -108,14 +141,962 @@ size_t fossil_algorithm_search_type_sizeof(const char *type_id);
  */
 bool fossil_algorithm_search_type_supported(const char *type_id);
 
-#ifdef __cplusplus
-}
+// ======================================================
+// Sorted-set operations
+// ======================================================
+
+/**
+ * @brief Intersection, union or difference of two sorted arrays.
+ *
+ * Both inputs must be sorted in @p order_id. Inputs of similar size are
+ * merged (the intersection loop is branch-free); when one side is more than
+ * 32 times longer, the shorter side gallops through it with the same
+ * exponential search as the "exponential" algorithm, so the cost follows the
+ * smaller list. Duplicates follow multiset rules: a value present m times in
+ * @p a and n times in @p b appears min(m, n) times in the intersection,
+ * max(m, n) times in the union and max(m - n, 0) times in the difference.
+ *
+ * Pass @p out = NULL to only count the result.
+ *
+ * Operations ("op_id"):
+ *   - "intersect": elements in both inputs (output fits min(a_count, b_count)).
+ *   - "union": elements in either input (output fits a_count + b_count).
+ *   - "difference": elements of @p a not in @p b (output fits a_count).
+ *
+ * Example:
+ * @code
+ * uint32_t docs_a[] = { 1, 4, 9, 12 }, docs_b[] = { 4, 5, 12 };
+ * uint32_t both[3];
+ * size_t n = 0;
+ * fossil_algorithm_search_set(docs_a, 4, docs_b, 3, both, &n, "u32", "intersect", "asc");
+ * // both = { 4, 12 }, n = 2
+ * @endcode
+ *
+ * @param a First sorted array.
+ * @param a_count Number of elements in @p a.
+ * @param b Second sorted array.
+ * @param b_count Number of elements in @p b.
+ * @param out Destination array, or NULL to count only.
+ * @param out_count Receives the number of result elements.
+ * @param type_id String identifier for data type (e.g., "i32", "cstr").
+ * @param op_id Operation identifier ("intersect", "union", "difference").
+ * @param order_id Sort order of the inputs ("asc", "desc").
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-2` for invalid input
+ *   - `-3` for unknown type or comparator
+ *   - `-4` for unknown operation
+ */
+int fossil_algorithm_search_set(
+    const void *a,
+    size_t a_count,
+    const void *b,
+    size_t b_count,
+    void *out,
+    size_t *out_count,
+    const char *type_id,
+    const char *op_id,
+    const char *order_id
+);
+
+/**
+ * @brief Intersection of any number of sorted arrays.
+ *
+ * The shortest list drives the loop; each candidate is galloped for in the
+ * other lists, shortest first, and every list keeps a cursor so no element
+ * is examined twice. Stops as soon as any list is exhausted.
+ *
+ * @param lists Array of @p list_count pointers to sorted arrays.
+ * @param counts Element count of each list.
+ * @param list_count Number of lists (at least 1).
+ * @param out Destination array (room for the shortest list), or NULL to
+ *        count only.
+ * @param out_count Receives the number of result elements.
+ * @param type_id String identifier for data type.
+ * @param order_id Sort order of the inputs ("asc", "desc").
+ * @return int Status code (0 on success, -2 invalid input, -3 unknown type,
+ *         -5 out of memory).
+ */
+int fossil_algorithm_search_intersect_many(
+    const void *const *lists,
+    const size_t *counts,
+    size_t list_count,
+    void *out,
+    size_t *out_count,
+    const char *type_id,
+    const char *order_id
+);
+
+// ======================================================
+// Finger search
+// ======================================================
+
+/**
+ * @brief Finds a key in a sorted array, starting from a position hint.
+ *
+ * The search gallops outward from @p hint (forward if the element there is
+ * ordered before the key, backward otherwise) with the same doubling steps
+ * as "exponential", so a lookup costs O(log d) for a distance d between the
+ * hint and the answer. On return @p hint holds the lower bound of the key
+ * (its insertion point), ready for the next key of a monotone stream such
+ * as a merge join or time-ordered lookups.
+ *
+ * @param base Pointer to the sorted array.
+ * @param count Number of elements in the array.
+ * @param key Pointer to the key to search for.
+ * @param type_id String identifier for data type.
+ * @param order_id Sort order of the array ("asc", "desc").
+ * @param hint In: starting position (clamped to @p count). Out: lower bound.
+ * @return int Index of the first element equal to the key, `-1` if not
+ *         found, `-2` for invalid input, `-3` for an unknown type.
+ */
+int fossil_algorithm_search_finger(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *order_id,
+    size_t *hint
+);
+
+/**
+ * @brief Opaque finger-search cursor over a sorted array.
+ *
+ * Resolves the type once and keeps the last lower bound as its finger, so
+ * a stream of lookups pays neither string dispatch nor a search from
+ * scratch. The cursor borrows the array; it must stay alive and unchanged
+ * while the cursor is used.
+ *
+ * Example:
+ * @code
+ * fossil_algorithm_search_cursor_t *c =
+ *     fossil_algorithm_search_cursor_create(times, n, "i64", "asc");
+ * for (size_t q = 0; q < query_count; ++q)
+ *     hits[q] = fossil_algorithm_search_cursor_find(c, &queries[q]);
+ * fossil_algorithm_search_cursor_destroy(c);
+ * @endcode
+ */
+typedef struct fossil_algorithm_search_cursor fossil_algorithm_search_cursor_t;
+
+/**
+ * @brief Creates a cursor positioned at the start of @p base.
+ *
+ * @param base Pointer to the sorted array (may be NULL when @p count is 0).
+ * @param count Number of elements in the array.
+ * @param type_id String identifier for data type.
+ * @param order_id Sort order of the array ("asc", "desc").
+ * @return Pointer to the cursor, or NULL for invalid input, an unknown type
+ *         or allocation failure.
+ */
+fossil_algorithm_search_cursor_t *fossil_algorithm_search_cursor_create(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id
+);
+
+/**
+ * @brief Destroys a cursor. Passing NULL is a no-op.
+ */
+void fossil_algorithm_search_cursor_destroy(fossil_algorithm_search_cursor_t *cursor);
+
+/**
+ * @brief Finds a key by galloping from the cursor, then moves the cursor to
+ *        the key's lower bound.
+ *
+ * @param cursor Cursor.
+ * @param key Pointer to the key to search for.
+ * @return int Index of the first element equal to the key, `-1` if not
+ *         found, `-2` for invalid input.
+ */
+int fossil_algorithm_search_cursor_find(fossil_algorithm_search_cursor_t *cursor, const void *key);
+
+/**
+ * @brief Current cursor position (the last lower bound found).
+ */
+size_t fossil_algorithm_search_cursor_position(const fossil_algorithm_search_cursor_t *cursor);
+
+/**
+ * @brief Moves the cursor to @p position (clamped to the array length).
+ */
+void fossil_algorithm_search_cursor_seek(fossil_algorithm_search_cursor_t *cursor, size_t position);
+
+// ======================================================
+// Nearest-value search
+// ======================================================
+
+/**
+ * @brief Finds the element closest to a key instead of an exact match.
+ *
+ * Modes ("mode_id"):
+ *   - "floor": the largest element <= key.
+ *   - "ceiling" (or "ceil"): the smallest element >= key.
+ *   - "nearest": whichever of floor and ceiling is closer; the floor wins
+ *     ties.
+ *   - "within": the nearest element, only if |element - key| <= @p epsilon.
+ *
+ * Sorted arrays ("asc", "desc") are searched with a branch-free lower and
+ * upper bound and a look at the two neighbours. With duplicates, the match
+ * is the copy adjacent to the key's insertion point. For "unsorted" the
+ * whole array is scanned once, and the first index of the chosen value
+ * wins.
+ *
+ * Numeric types are accepted: "i8" … "u64", "f32", "f64" and "size". Also
+ * accepted are "datetime" and "duration" as int64_t, and "hex", "oct" and
+ * "bin" as uint64_t. Integer distances are exact; a NaN key matches nothing.
+ *
+ * Example (as-of lookup):
+ * @code
+ * int i = fossil_algorithm_search_nearest(quote_times, n, &event_time,
+ *                                         "datetime", "floor", "asc", 0.0);
+ * @endcode
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param key Pointer to the key.
+ * @param type_id Numeric type identifier.
+ * @param mode_id "floor", "ceiling", "nearest" (NULL) or "within".
+ * @param order_id "asc" (NULL), "desc" or "unsorted".
+ * @param epsilon Tolerance for "within"; ignored by the other modes.
+ * @return int Index of the matching element, or a negative code:
+ *   - `-1` when no element qualifies
+ *   - `-2` for invalid input
+ *   - `-3` for an unknown or non-numeric type
+ *   - `-4` for an unknown mode
+ */
+int fossil_algorithm_search_nearest(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *mode_id,
+    const char *order_id,
+    double epsilon
+);
+
+/**
+ * @brief Batched @ref fossil_algorithm_search_nearest.
+ *
+ * On sorted arrays each key gallops from the bounds of the previous key,
+ * so a sorted key stream (an as-of join) costs O(log d) per key, where d is
+ * the distance between consecutive answers. Keys in any order still give
+ * correct results. Unsorted arrays cost one scan per key.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param keys Array of @p key_count keys of the same type.
+ * @param key_count Number of keys.
+ * @param type_id Numeric type identifier.
+ * @param mode_id "floor", "ceiling", "nearest" (NULL) or "within".
+ * @param order_id "asc" (NULL), "desc" or "unsorted".
+ * @param epsilon Tolerance for "within".
+ * @param out Receives one index per key, or -1 when no element qualifies.
+ * @return int Status code (0 on success, -2 invalid input, -3 unknown or
+ *         non-numeric type, -4 unknown mode).
+ */
+int fossil_algorithm_search_nearest_many(
+    const void *base,
+    size_t count,
+    const void *keys,
+    size_t key_count,
+    const char *type_id,
+    const char *mode_id,
+    const char *order_id,
+    double epsilon,
+    int *out
+);
+
+// ======================================================
+// Min / max reductions
+// ======================================================
+
+/**
+ * @brief Indices of the smallest and largest elements in one pass.
+ *
+ * The first index wins ties. Fixed-width types take a two-step path. First,
+ * a value pass keeps four independent min/max lanes that compile to vector
+ * min/max. Then an early-exit pass finds the first index of each extreme.
+ * "cstr" and other comparator types take a single pass. NaN elements are
+ * skipped. "datetime" and "duration" reduce as int64_t, and "hex", "oct"
+ * and "bin" as uint64_t.
+ *
+ * With @p threads > 1, large arrays are split into that many chunks, each
+ * reduced on its own thread. Chunks are kept to at least 65536 elements,
+ * so small inputs stay on the caller.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param type_id String identifier for data type.
+ * @param min_index Receives the index of the minimum (may be NULL).
+ * @param max_index Receives the index of the maximum (may be NULL).
+ * @param threads Number of worker threads (0 or 1 runs on the caller).
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` if every element is NaN
+ *   - `-2` for invalid input (including an empty array)
+ *   - `-3` for unknown type
+ */
+int fossil_algorithm_search_minmax(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    size_t *min_index,
+    size_t *max_index,
+    size_t threads
+);
+
+/**
+ * @brief Index of the first smallest element.
+ *
+ * @return int Index, or a negative code as for @ref fossil_algorithm_search_minmax.
+ */
+int fossil_algorithm_search_argmin(const void *base, size_t count, const char *type_id);
+
+/**
+ * @brief Index of the first largest element.
+ *
+ * @return int Index, or a negative code as for @ref fossil_algorithm_search_minmax.
+ */
+int fossil_algorithm_search_argmax(const void *base, size_t count, const char *type_id);
+
+/**
+ * @brief Copies the smallest element to @p out.
+ *
+ * @return int Status code, as for @ref fossil_algorithm_search_minmax.
+ */
+int fossil_algorithm_search_min(const void *base, size_t count, const char *type_id, void *out);
+
+/**
+ * @brief Copies the largest element to @p out.
+ *
+ * @return int Status code, as for @ref fossil_algorithm_search_minmax.
+ */
+int fossil_algorithm_search_max(const void *base, size_t count, const char *type_id, void *out);
+
+// ======================================================
+// Filter scans
+// ======================================================
+
+/**
+ * @brief Indices of every element that satisfies a predicate (selection
+ *        vector).
+ *
+ * Unlike @ref fossil_algorithm_search_exec, the scan does not stop at the
+ * first hit. It walks the array once and writes each matching index in
+ * ascending order. The store is branch-free: every index is written, and
+ * the cursor advances only on a match. So @p indices needs room for
+ * @p count entries.
+ *
+ * Predicates (@p lo and @p hi point to a value of the array's type), as for
+ * @ref fossil_algorithm_sort_partition_if:
+ *   - "eq", "ne", "lt", "le", "gt", "ge": compare against *lo.
+ *   - "range": *lo <= x && x <= *hi.
+ *
+ * All fixed-width types are accepted. "datetime" and "duration" are read as
+ * int64_t, and "hex", "oct" and "bin" as uint64_t. NaN matches only "ne".
+ * With @p threads > 1, arrays above 64K elements per thread are split into
+ * chunks scanned in parallel. The result is identical to a single-threaded
+ * scan.
+ *
+ * Example:
+ * @code
+ * double lo = 10.0, hi = 20.0;
+ * size_t n_hits = 0;
+ * fossil_algorithm_search_find_all(prices, n, "f64", "range", &lo, &hi, sel, &n_hits, 4);
+ * @endcode
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param type_id Fixed-width type identifier.
+ * @param predicate_id Predicate identifier (see above).
+ * @param lo Predicate operand.
+ * @param hi Upper bound for "range" (may be NULL otherwise).
+ * @param indices Output selection vector with room for @p count entries.
+ * @param match_count Receives the number of matches.
+ * @param threads Number of worker threads (0 or 1 runs on the caller).
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-2` for invalid input
+ *   - `-3` for unknown or non fixed-width type
+ *   - `-4` for unknown predicate
+ */
+int fossil_algorithm_search_find_all(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *indices,
+    size_t *match_count,
+    size_t threads
+);
+
+/**
+ * @brief Match bitmap for a predicate.
+ *
+ * Bit (i % 8) of byte (i / 8) is set when element i matches. This is the
+ * layout of the "mask" predicate of @ref fossil_algorithm_sort_partition_if
+ * and @ref fossil_algorithm_sort_filter, so a scan can drive a compaction
+ * directly. Unused bits of the last byte are cleared.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param type_id Fixed-width type identifier.
+ * @param predicate_id Predicate identifier, as for
+ *        @ref fossil_algorithm_search_find_all.
+ * @param lo Predicate operand.
+ * @param hi Upper bound for "range" (may be NULL otherwise).
+ * @param bitmap Output of (count + 7) / 8 bytes.
+ * @param match_count Receives the number of matches.
+ * @param threads Number of worker threads (0 or 1 runs on the caller).
+ * @return int Status code, as for @ref fossil_algorithm_search_find_all.
+ */
+int fossil_algorithm_search_match_bitmap(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    unsigned char *bitmap,
+    size_t *match_count,
+    size_t threads
+);
+
+/**
+ * @brief Number of elements that satisfy a predicate.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param type_id Fixed-width type identifier.
+ * @param predicate_id Predicate identifier, as for
+ *        @ref fossil_algorithm_search_find_all.
+ * @param lo Predicate operand.
+ * @param hi Upper bound for "range" (may be NULL otherwise).
+ * @param match_count Receives the number of matches.
+ * @param threads Number of worker threads (0 or 1 runs on the caller).
+ * @return int Status code, as for @ref fossil_algorithm_search_find_all.
+ */
+int fossil_algorithm_search_count_matches(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *match_count,
+    size_t threads
+);
+
+/**
+ * @brief Multithreaded linear search for large unsorted arrays.
+ *
+ * The array is cut into 16K-element blocks dealt round-robin to the
+ * workers, which sweep it front to back together. A worker publishes the
+ * first match it finds and checks the shared result before every block:
+ * in "first" mode it stops once a match below its next block is known, so
+ * the lowest matching index is still reported; in "any" mode every worker
+ * stops at the first match published, whichever index that is.
+ *
+ * @param base Pointer to the array to search.
+ * @param count Number of elements in the array.
+ * @param key Pointer to the key to search for.
+ * @param type_id Type identifier; any type accepted by
+ *        @ref fossil_algorithm_search_exec.
+ * @param mode_id "first" (default when NULL) or "any".
+ * @param threads Number of worker threads; 0 uses one per CPU. Scaled down
+ *        so each worker gets at least 64K elements.
+ * @param index Receives the index of the match.
+ * @return int `0` when found, `-1` not found, `-2` invalid input,
+ *         `-3` unknown type, `-4` unknown mode, `-5` out of resources.
+ */
+int fossil_algorithm_search_parallel(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *mode_id,
+    size_t threads,
+    size_t *index
+);
+
+/**
+ * @brief Searches one field of an array of records in place.
+ *
+ * Record @p i starts at `base + i * stride`; the searched field sits at
+ * @p offset within it, so an array of structs can be searched by a member
+ * with `stride = sizeof(record)` and `offset = offsetof(record, member)`
+ * instead of copying the keys out first. The field must be aligned for its
+ * type, as any struct member is. A dense array is the case
+ * `stride == sizeof(type)`, `offset == 0`.
+ *
+ * Fixed-width types ("i8" to "f64", "char", "bool", "size", "hex", "oct",
+ * "bin", "datetime", "duration") use typed kernels for "auto"/"linear",
+ * "binary" (first equal record) and "interpolation" (integers only).
+ * "jump", "exponential", "fibonacci" and every algorithm on "cstr" fields
+ * use the comparators of @ref fossil_algorithm_search_exec.
+ *
+ * @param base Pointer to the first record.
+ * @param count Number of records.
+ * @param stride Distance in bytes between consecutive records.
+ * @param offset Byte offset of the field within a record.
+ * @param key Pointer to the key, laid out as the field.
+ * @param type_id Type identifier of the field.
+ * @param algorithm_id Algorithm identifier, as for
+ *        @ref fossil_algorithm_search_exec ("parallel" excepted).
+ * @param order_id "asc" or "desc" for the sorted algorithms.
+ * @return int Record index of the match, or a negative error code as for
+ *         @ref fossil_algorithm_search_exec; `-2` also when the field does
+ *         not fit within @p stride.
+ */
+int fossil_algorithm_search_strided(
+    const void *base,
+    size_t count,
+    size_t stride,
+    size_t offset,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id
+);
+
+/**
+ * @brief First occurrence of a multi-element needle in a haystack.
+ *
+ * Works on any fixed-width integer type_id ("char", "u8", "i16", "i32",
+ * "u64", "size", "datetime", ...); elements match when their bytes are
+ * equal. Floating-point types are rejected, since bit equality would
+ * disagree with the comparators on 0.0/-0.0 and NaN.
+ *
+ * Candidate positions are filtered by the first and last needle element
+ * and verified element by element. A needle that keeps passing the filter
+ * without matching hands the rest of the haystack to the Two-Way algorithm,
+ * so the worst case is linear in @p count with no extra memory.
+ *
+ * @param base Pointer to the haystack.
+ * @param count Number of elements in the haystack.
+ * @param needle Pointer to the needle.
+ * @param needle_count Number of elements in the needle (at least 1).
+ * @param type_id Element type identifier.
+ * @return int Index of the first occurrence, `-1` not found, `-2` invalid
+ *         input, `-3` unsupported type.
+ */
+int fossil_algorithm_search_subsequence(
+    const void *base,
+    size_t count,
+    const void *needle,
+    size_t needle_count,
+    const char *type_id
+);
+
+/**
+ * @brief Every occurrence of a needle, overlapping ones included.
+ *
+ * @param base Pointer to the haystack.
+ * @param count Number of elements in the haystack.
+ * @param needle Pointer to the needle.
+ * @param needle_count Number of elements in the needle (at least 1).
+ * @param type_id Element type identifier, as for
+ *        @ref fossil_algorithm_search_subsequence.
+ * @param indices Receives the start indices in ascending order; needs room
+ *        for `count - needle_count + 1` entries. NULL only counts.
+ * @param match_count Receives the number of occurrences.
+ * @return int `0` on success, `-2` invalid input, `-3` unsupported type.
+ */
+int fossil_algorithm_search_subsequence_all(
+    const void *base,
+    size_t count,
+    const void *needle,
+    size_t needle_count,
+    const char *type_id,
+    size_t *indices,
+    size_t *match_count
+);
+
+/**
+ * @brief Opaque multi-pattern matcher.
+ *
+ * An Aho-Corasick automaton over the patterns' element bytes, built once
+ * and reused across haystacks. Each haystack byte costs one table lookup
+ * however many patterns there are; the table takes 1 KiB per pattern byte.
+ */
+typedef struct fossil_algorithm_search_patterns fossil_algorithm_search_patterns_t;
+
+/**
+ * @brief Builds a matcher for a set of needles.
+ *
+ * The patterns are copied; identical patterns report the lowest index.
+ *
+ * @param patterns Array of @p pattern_count needle pointers.
+ * @param lengths Element count of each needle (each at least 1).
+ * @param pattern_count Number of needles.
+ * @param type_id Element type identifier, as for
+ *        @ref fossil_algorithm_search_subsequence.
+ * @return Pointer to the matcher, or NULL for invalid input, an unsupported
+ *         type or allocation failure.
+ */
+fossil_algorithm_search_patterns_t *fossil_algorithm_search_patterns_create(
+    const void *const *patterns,
+    const size_t *lengths,
+    size_t pattern_count,
+    const char *type_id
+);
+
+/**
+ * @brief Destroys a matcher. Passing NULL is a no-op.
+ */
+void fossil_algorithm_search_patterns_destroy(fossil_algorithm_search_patterns_t *set);
+
+/**
+ * @brief Leftmost occurrence of any pattern.
+ *
+ * @param set Matcher.
+ * @param base Pointer to the haystack, of the matcher's type.
+ * @param count Number of elements in the haystack.
+ * @param pattern Receives the index of the matching pattern (may be NULL);
+ *        the lowest one when several start at the same element.
+ * @return int Start index of the match, `-1` not found, `-2` invalid input.
+ */
+int fossil_algorithm_search_patterns_find(
+    const fossil_algorithm_search_patterns_t *set,
+    const void *base,
+    size_t count,
+    size_t *pattern
+);
+
+/**
+ * @brief Every occurrence of every pattern, in the order they end.
+ *
+ * @param set Matcher.
+ * @param base Pointer to the haystack, of the matcher's type.
+ * @param count Number of elements in the haystack.
+ * @param indices Receives start indices (may be NULL).
+ * @param pattern_ids Receives the matching pattern indices (may be NULL).
+ * @param capacity Entries available in @p indices and @p pattern_ids;
+ *        further matches are counted but not stored.
+ * @param match_count Receives the total number of matches.
+ * @return int `0` on success, `-2` invalid input.
+ */
+int fossil_algorithm_search_patterns_find_all(
+    const fossil_algorithm_search_patterns_t *set,
+    const void *base,
+    size_t count,
+    size_t *indices,
+    size_t *pattern_ids,
+    size_t capacity,
+    size_t *match_count
+);
+
+// ======================================================
+// Membership filters
+// ======================================================
+
+/**
+ * @brief Opaque approximate-membership filter over the values of an array.
+ *
+ * A filter answers "definitely absent" or "maybe present" for a key in a
+ * few cache-line reads, so a lookup that misses can skip the search. Keys
+ * present when the filter was built are never reported absent. Methods:
+ *   - "bloom": split-block Bloom filter. Each key sets one bit in each of
+ *     the eight words of one 256-bit block, so a probe reads one cache
+ *     line. About 1.3% false positives at 10 bits per key, 0.13% at 16.
+ *   - "xor": static xor filter with 8-bit fingerprints, about 9.9 bits per
+ *     key and a 0.39% false-positive rate. Smaller and more accurate than
+ *     Bloom at the same budget, but slower to build.
+ *
+ * Fixed-width type identifiers and "cstr" are accepted. Keys equal under
+ * the search comparators are equal to the filter: 0.0 and -0.0 hash alike,
+ * strings hash by content. An array containing NaN matches every key, so
+ * such a filter reports every key as maybe present. The filter does not
+ * track later changes to the array; rebuild it after modifying the data.
+ */
+typedef struct fossil_algorithm_search_filter fossil_algorithm_search_filter_t;
+
+/**
+ * @brief Size and accuracy of a filter, filled by
+ *        @ref fossil_algorithm_search_filter_stats.
+ */
+typedef struct fossil_algorithm_search_filter_stats_t {
+    size_t key_count;           /**< Keys inserted (distinct keys for "xor"). */
+    size_t memory_bytes;        /**< Bytes of filter storage. */
+    double bits_per_key;        /**< Filter bits per inserted key. */
+    double false_positive_rate; /**< Chance that an absent key passes: measured from the bits for "bloom", 1/256 for "xor". */
+} fossil_algorithm_search_filter_stats_t;
+
+/**
+ * @brief Builds a filter over the values of an array.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements in the array.
+ * @param type_id Fixed-width type identifier or "cstr".
+ * @param method_id "bloom" (default when NULL) or "xor".
+ * @param bits_per_key Bloom budget per key (0 picks 10); ignored by "xor".
+ * @return Pointer to the filter, or NULL for invalid input, an unsupported
+ *         type or method, or allocation failure.
+ */
+fossil_algorithm_search_filter_t *fossil_algorithm_search_filter_create(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *method_id,
+    double bits_per_key
+);
+
+/**
+ * @brief Destroys a filter. Passing NULL is a no-op.
+ */
+void fossil_algorithm_search_filter_destroy(fossil_algorithm_search_filter_t *filter);
+
+/**
+ * @brief Tests a key against a filter.
+ *
+ * @param filter Filter.
+ * @param key Pointer to the key, of the filter's type.
+ * @return false when the key is definitely absent, true when it may be
+ *         present.
+ */
+bool fossil_algorithm_search_filter_contains(const fossil_algorithm_search_filter_t *filter, const void *key);
+
+/**
+ * @brief Reports the size and false-positive rate of a filter.
+ *
+ * @param filter Filter.
+ * @param out Receives the statistics.
+ * @return int `0` on success, `-2` invalid input.
+ */
+int fossil_algorithm_search_filter_stats(
+    const fossil_algorithm_search_filter_t *filter,
+    fossil_algorithm_search_filter_stats_t *out
+);
+
+/**
+ * @brief @ref fossil_algorithm_search_exec behind a membership filter.
+ *
+ * The filter is consulted first; a key it rules out returns `-1` without
+ * touching @p base. Other keys run the chosen algorithm as usual.
+ *
+ * @param filter Filter built over @p base with the same type.
+ * @param base Pointer to the array to search.
+ * @param count Number of elements in the array.
+ * @param key Pointer to the key to search for.
+ * @param type_id Type identifier the filter was built with.
+ * @param algorithm_id Algorithm identifier.
+ * @param order_id "asc" or "desc".
+ * "datetime" and "duration" keys, which exec does not accept, are searched
+ * with their i64 layout.
+ *
+ * @return int As for @ref fossil_algorithm_search_exec; `-3` also when
+ *         @p type_id does not match the filter.
+ */
+int fossil_algorithm_search_exec_filtered(
+    const fossil_algorithm_search_filter_t *filter,
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id
+);
+
+#ifdef __cplusplus
+}
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace fossil {
+
+    namespace algorithm {
+
+        namespace detail {
+
+            /**
+             * @brief Default ordering for the compile-time search helpers.
+             */
+            struct search_less
+            {
+                template <typename A, typename B>
+                constexpr bool operator()(const A &a, const B &b) const noexcept { return a < b; }
+            };
+
+            /**
+             * @brief FNV-1a over a string, usable in constant expressions.
+             */
+            constexpr std::uint64_t perfect_hash_fnv(std::string_view key) noexcept
+            {
+                std::uint64_t h = 14695981039346656037ull;
+                for (char c : key) {
+                    h ^= static_cast<unsigned char>(c);
+                    h *= 1099511628211ull;
+                }
+                return h;
+            }
+
+            /**
+             * @brief Mixes a key hash with a per-bucket displacement.
+             */
+            constexpr std::uint64_t perfect_hash_mix(std::uint64_t h, std::uint32_t d) noexcept
+            {
+                std::uint64_t x = h ^ (static_cast<std::uint64_t>(d) * 0x9E3779B97F4A7C15ull);
+                x ^= x >> 33;
+                x *= 0xff51afd7ed558ccdull;
+                x ^= x >> 33;
+                return x;
+            }
+
+        } // namespace detail
+
+        /**
+         * @brief Binary search over a std::array, usable at compile time.
+         *
+         * Pairs with static_sort() for tables built at compile time. With a
+         * custom predicate the key may have a different type than the
+         * elements (e.g. looking up a name in a table of name/value pairs), as
+         * long as the predicate accepts both argument orders.
+         *
+         * @param data Sorted array to search.
+         * @param key Key to look for.
+         * @param less Ordering predicate the array is sorted by.
+         * @return Index of a matching element, or -1 if not found.
+         */
+        template <typename T, std::size_t N, typename K, typename Less = detail::search_less>
+        constexpr std::ptrdiff_t static_binary_search(const std::array<T, N> &data, const K &key, Less less = Less{})
+        {
+            std::size_t low = 0, high = N;
+            while (low < high) {
+                std::size_t mid = low + (high - low) / 2;
+                if (less(data[mid], key))
+                    low = mid + 1;
+                else
+                    high = mid;
+            }
+            if (low < N && !less(key, data[low]))
+                return static_cast<std::ptrdiff_t>(low);
+            return -1;
+        }
+
+        /**
+         * @brief Minimal-probe perfect hash over a fixed set of string keys.
+         *
+         * Built with make_perfect_hash() using hash-and-displace: keys are
+         * grouped into buckets of about four, and each bucket gets the first
+         * displacement that places all of its keys in free slots. A lookup is
+         * one hash, one displacement read and one string compare.
+         *
+         * Check @ref ok after building: it is false when the key set contains
+         * duplicates or no displacement was found.
+         */
+        template <std::size_t N>
+        struct PerfectHash
+        {
+            static constexpr std::size_t bucket_count = N / 4 + 1;
+            static constexpr std::size_t slot_count = N + N / 4 + 1;
+            static constexpr std::uint32_t empty_slot = 0xFFFFFFFFu;
+
+            std::array<std::string_view, N> keys{};
+            std::array<std::uint32_t, bucket_count> displacement{};
+            std::array<std::uint32_t, slot_count> slots{};
+            bool ok = false;
+
+            /**
+             * @brief Looks up a key.
+             *
+             * @param key Key to look for.
+             * @return Index of the key in the array given to make_perfect_hash(), or -1.
+             */
+            constexpr std::ptrdiff_t find(std::string_view key) const noexcept
+            {
+                std::uint64_t h = detail::perfect_hash_fnv(key);
+                std::uint32_t d = displacement[h % bucket_count];
+                std::uint32_t idx = slots[detail::perfect_hash_mix(h, d) % slot_count];
+                if (idx == empty_slot || keys[idx] != key)
+                    return -1;
+                return static_cast<std::ptrdiff_t>(idx);
+            }
+        };
+
+        /**
+         * @brief Builds a perfect hash for a fixed key set, usable at compile time.
+         *
+         * @code
+         * constexpr auto kw = fossil::algorithm::make_perfect_hash<3>({"if", "else", "while"});
+         * static_assert(kw.ok && kw.find("else") == 1);
+         * @endcode
+         *
+         * @tparam N Number of keys.
+         * @param keys Distinct keys; the returned table refers to them by index.
+         * @return The table; check PerfectHash::ok.
+         */
+        template <std::size_t N>
+        constexpr PerfectHash<N> make_perfect_hash(const std::array<std::string_view, N> &keys)
+        {
+            using table_t = PerfectHash<N>;
+            table_t t{};
+            t.keys = keys;
+            for (std::size_t s = 0; s < table_t::slot_count; ++s)
+                t.slots[s] = table_t::empty_slot;
+
+            std::array<std::uint64_t, N> hash{};
+            std::array<std::size_t, table_t::bucket_count + 1> start{};
+            for (std::size_t i = 0; i < N; ++i) {
+                for (std::size_t j = 0; j < i; ++j)
+                    if (keys[i] == keys[j])
+                        return t;
+                hash[i] = detail::perfect_hash_fnv(keys[i]);
+                ++start[hash[i] % table_t::bucket_count + 1];
+            }
 
-#include <string>
+            // Group key indices by bucket so each bucket is a contiguous run.
+            for (std::size_t b = 0; b < table_t::bucket_count; ++b)
+                start[b + 1] += start[b];
+            std::array<std::size_t, N> member{};
+            std::array<std::size_t, table_t::bucket_count> fill{};
+            for (std::size_t i = 0; i < N; ++i) {
+                std::size_t b = hash[i] % table_t::bucket_count;
+                member[start[b] + fill[b]++] = i;
+            }
 
-namespace fossil {
+            // Place the largest buckets first, while most slots are free.
+            std::array<bool, table_t::bucket_count> done{};
+            std::array<std::size_t, N + 1> taken{};
+            for (std::size_t round = 0; round < table_t::bucket_count; ++round) {
+                std::size_t b = table_t::bucket_count;
+                for (std::size_t c = 0; c < table_t::bucket_count; ++c)
+                    if (!done[c] && (b == table_t::bucket_count || fill[c] > fill[b]))
+                        b = c;
+                done[b] = true;
+                if (fill[b] == 0)
+                    continue;
 
-    namespace algorithm {
+                bool placed = false;
+                for (std::uint32_t d = 0; d < (1u << 20) && !placed; ++d) {
+                    std::size_t used = 0;
+                    placed = true;
+                    for (std::size_t m = start[b]; m < start[b + 1]; ++m) {
+                        std::size_t s = detail::perfect_hash_mix(hash[member[m]], d) % table_t::slot_count;
+                        if (t.slots[s] != table_t::empty_slot) {
+                            placed = false;
+                            break;
+                        }
+                        t.slots[s] = static_cast<std::uint32_t>(member[m]);
+                        taken[used++] = s;
+                    }
+                    if (placed)
+                        t.displacement[b] = d;
+                    else
+                        while (used > 0)
+                            t.slots[taken[--used]] = table_t::empty_slot;
+                }
+                if (!placed)
+                    return t;
+            }
+            t.ok = true;
+            return t;
+        }
 
         /**
          * @brief RAII-friendly C++ wrapper for Fossil searching algorithms.
@@ -160,6 +1141,36 @@ namespace fossil {
                 );
             }
 
+            /**
+             * @brief Like exec(), but first verifies that sorted-only algorithms
+             *        get sorted input.
+             *
+             * @param base Pointer to the array to search.
+             * @param count Number of elements in the array.
+             * @param key Pointer to the key to search for.
+             * @param type_id String identifier for data type.
+             * @param algorithm_id String identifier for search algorithm.
+             * @param order_id String identifier for sort order ("asc", "desc").
+             * @return int Index of found element, or negative error code (-6 if unsorted).
+             */
+            static int exec_checked(
+            const void *base,
+            size_t count,
+            const void *key,
+            const std::string &type_id,
+            const std::string &algorithm_id = "binary",
+            const std::string &order_id = "asc"
+            ) {
+                return fossil_algorithm_search_exec_checked(
+                    base,
+                    count,
+                    key,
+                    type_id.c_str(),
+                    algorithm_id.c_str(),
+                    order_id.c_str()
+                );
+            }
+
             /**
              * @brief Returns the byte size of a type based on its string identifier.
              *
@@ -180,6 +1191,555 @@ namespace fossil {
                 return fossil_algorithm_search_type_supported(type_id.c_str());
             }
 
+            /**
+             * @brief Intersection, union or difference of two sorted arrays.
+             *
+             * @param a First sorted array.
+             * @param a_count Number of elements in @p a.
+             * @param b Second sorted array.
+             * @param b_count Number of elements in @p b.
+             * @param out Destination array, or nullptr to count only.
+             * @param out_count Receives the number of result elements.
+             * @param type_id Type identifier.
+             * @param op_id "intersect", "union" or "difference".
+             * @param order_id Sort order of the inputs.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int set(
+            const void *a,
+            size_t a_count,
+            const void *b,
+            size_t b_count,
+            void *out,
+            size_t *out_count,
+            const std::string &type_id,
+            const std::string &op_id,
+            const std::string &order_id = "asc"
+            ) {
+                return fossil_algorithm_search_set(
+                    a, a_count, b, b_count, out, out_count,
+                    type_id.c_str(), op_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief Intersection of any number of sorted arrays.
+             *
+             * @param lists Pointers to the sorted arrays.
+             * @param counts Element count of each list.
+             * @param list_count Number of lists.
+             * @param out Destination array, or nullptr to count only.
+             * @param out_count Receives the number of result elements.
+             * @param type_id Type identifier.
+             * @param order_id Sort order of the inputs.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int intersect_many(
+            const void *const *lists,
+            const size_t *counts,
+            size_t list_count,
+            void *out,
+            size_t *out_count,
+            const std::string &type_id,
+            const std::string &order_id = "asc"
+            ) {
+                return fossil_algorithm_search_intersect_many(
+                    lists, counts, list_count, out, out_count,
+                    type_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief Finger search from a position hint.
+             *
+             * @param base Pointer to the sorted array.
+             * @param count Number of elements in the array.
+             * @param key Pointer to the key to search for.
+             * @param type_id Type identifier.
+             * @param hint In: starting position. Out: lower bound of the key.
+             * @param order_id Sort order of the array.
+             * @return int Index of found element, or negative error code.
+             */
+            static int finger(
+            const void *base,
+            size_t count,
+            const void *key,
+            const std::string &type_id,
+            size_t &hint,
+            const std::string &order_id = "asc"
+            ) {
+                return fossil_algorithm_search_finger(
+                    base, count, key, type_id.c_str(), order_id.c_str(), &hint);
+            }
+
+            /**
+             * @brief Floor, ceiling, nearest or within-epsilon search.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param key Pointer to the key.
+             * @param type_id Numeric type identifier.
+             * @param mode_id "floor", "ceiling", "nearest" or "within".
+             * @param order_id "asc", "desc" or "unsorted".
+             * @param epsilon Tolerance for "within".
+             * @return int Index of the match, or negative code.
+             */
+            static int nearest(
+            const void *base,
+            size_t count,
+            const void *key,
+            const std::string &type_id,
+            const std::string &mode_id = "nearest",
+            const std::string &order_id = "asc",
+            double epsilon = 0.0
+            ) {
+                return fossil_algorithm_search_nearest(
+                    base, count, key, type_id.c_str(), mode_id.c_str(), order_id.c_str(), epsilon);
+            }
+
+            /**
+             * @brief Batched nearest-value search.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param keys Keys to look up.
+             * @param key_count Number of keys.
+             * @param out One index (or -1) per key.
+             * @param type_id Numeric type identifier.
+             * @param mode_id "floor", "ceiling", "nearest" or "within".
+             * @param order_id "asc", "desc" or "unsorted".
+             * @param epsilon Tolerance for "within".
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int nearest_many(
+            const void *base,
+            size_t count,
+            const void *keys,
+            size_t key_count,
+            int *out,
+            const std::string &type_id,
+            const std::string &mode_id = "nearest",
+            const std::string &order_id = "asc",
+            double epsilon = 0.0
+            ) {
+                return fossil_algorithm_search_nearest_many(
+                    base, count, keys, key_count, type_id.c_str(), mode_id.c_str(), order_id.c_str(), epsilon, out);
+            }
+
+            /**
+             * @brief Indices of the smallest and largest elements.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param type_id Type identifier.
+             * @param min_index Receives the index of the minimum (may be nullptr).
+             * @param max_index Receives the index of the maximum (may be nullptr).
+             * @param threads Number of worker threads.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int minmax(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            size_t *min_index,
+            size_t *max_index,
+            size_t threads = 1
+            ) {
+                return fossil_algorithm_search_minmax(base, count, type_id.c_str(), min_index, max_index, threads);
+            }
+
+            /** @brief Index of the first smallest element, or negative error code. */
+            static int argmin(const void *base, size_t count, const std::string &type_id) {
+                return fossil_algorithm_search_argmin(base, count, type_id.c_str());
+            }
+
+            /** @brief Index of the first largest element, or negative error code. */
+            static int argmax(const void *base, size_t count, const std::string &type_id) {
+                return fossil_algorithm_search_argmax(base, count, type_id.c_str());
+            }
+
+            /** @brief Copies the smallest element to @p out. */
+            static int min_value(const void *base, size_t count, const std::string &type_id, void *out) {
+                return fossil_algorithm_search_min(base, count, type_id.c_str(), out);
+            }
+
+            /** @brief Copies the largest element to @p out. */
+            static int max_value(const void *base, size_t count, const std::string &type_id, void *out) {
+                return fossil_algorithm_search_max(base, count, type_id.c_str(), out);
+            }
+
+            /**
+             * @brief Selection vector of every matching index.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param type_id Fixed-width type identifier.
+             * @param predicate_id "eq", "ne", "lt", "le", "gt", "ge" or "range".
+             * @param lo Predicate operand.
+             * @param hi Upper bound for "range" (may be nullptr otherwise).
+             * @param indices Output with room for @p count entries.
+             * @param match_count Receives the number of matches.
+             * @param threads Number of worker threads.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int find_all(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &predicate_id,
+            const void *lo,
+            const void *hi,
+            size_t *indices,
+            size_t *match_count,
+            size_t threads = 1
+            ) {
+                return fossil_algorithm_search_find_all(
+                    base, count, type_id.c_str(), predicate_id.c_str(), lo, hi, indices, match_count, threads);
+            }
+
+            /**
+             * @brief Match bitmap (bit i % 8 of byte i / 8).
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param type_id Fixed-width type identifier.
+             * @param predicate_id Predicate identifier.
+             * @param lo Predicate operand.
+             * @param hi Upper bound for "range" (may be nullptr otherwise).
+             * @param bitmap Output of (count + 7) / 8 bytes.
+             * @param match_count Receives the number of matches.
+             * @param threads Number of worker threads.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int match_bitmap(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &predicate_id,
+            const void *lo,
+            const void *hi,
+            unsigned char *bitmap,
+            size_t *match_count,
+            size_t threads = 1
+            ) {
+                return fossil_algorithm_search_match_bitmap(
+                    base, count, type_id.c_str(), predicate_id.c_str(), lo, hi, bitmap, match_count, threads);
+            }
+
+            /**
+             * @brief Number of matching elements.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param type_id Fixed-width type identifier.
+             * @param predicate_id Predicate identifier.
+             * @param lo Predicate operand.
+             * @param hi Upper bound for "range" (may be nullptr otherwise).
+             * @param match_count Receives the number of matches.
+             * @param threads Number of worker threads.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int count_matches(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &predicate_id,
+            const void *lo,
+            const void *hi,
+            size_t *match_count,
+            size_t threads = 1
+            ) {
+                return fossil_algorithm_search_count_matches(
+                    base, count, type_id.c_str(), predicate_id.c_str(), lo, hi, match_count, threads);
+            }
+
+            /**
+             * @brief Multithreaded linear search.
+             *
+             * @param base Pointer to the array to search.
+             * @param count Number of elements in the array.
+             * @param key Pointer to the key to search for.
+             * @param type_id Type identifier.
+             * @param index Receives the index of the match.
+             * @param mode_id "first" or "any".
+             * @param threads Number of worker threads (0 = one per CPU).
+             * @return int 0 when found, negative otherwise.
+             */
+            static int parallel(
+            const void *base,
+            size_t count,
+            const void *key,
+            const std::string &type_id,
+            size_t &index,
+            const std::string &mode_id = "first",
+            size_t threads = 0
+            ) {
+                return fossil_algorithm_search_parallel(
+                    base, count, key, type_id.c_str(), mode_id.c_str(), threads, &index);
+            }
+
+            /**
+             * @brief Searches one field of an array of records in place.
+             *
+             * @param base Pointer to the first record.
+             * @param count Number of records.
+             * @param stride Distance in bytes between records.
+             * @param offset Byte offset of the field within a record.
+             * @param key Pointer to the key, laid out as the field.
+             * @param type_id Type identifier of the field.
+             * @param algorithm_id Algorithm identifier.
+             * @param order_id "asc" or "desc".
+             * @return int Record index of the match, or negative error code.
+             */
+            static int strided(
+            const void *base,
+            size_t count,
+            size_t stride,
+            size_t offset,
+            const void *key,
+            const std::string &type_id,
+            const std::string &algorithm_id = "auto",
+            const std::string &order_id = "asc"
+            ) {
+                return fossil_algorithm_search_strided(
+                    base, count, stride, offset, key, type_id.c_str(), algorithm_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief First occurrence of a multi-element needle.
+             *
+             * @param base Pointer to the haystack.
+             * @param count Number of elements in the haystack.
+             * @param needle Pointer to the needle.
+             * @param needle_count Number of elements in the needle.
+             * @param type_id Element type identifier.
+             * @return int Index of the first occurrence, or negative error code.
+             */
+            static int subsequence(
+            const void *base,
+            size_t count,
+            const void *needle,
+            size_t needle_count,
+            const std::string &type_id
+            ) {
+                return fossil_algorithm_search_subsequence(base, count, needle, needle_count, type_id.c_str());
+            }
+
+            /**
+             * @brief Every occurrence of a needle, overlapping ones included.
+             *
+             * @param base Pointer to the haystack.
+             * @param count Number of elements in the haystack.
+             * @param needle Pointer to the needle.
+             * @param needle_count Number of elements in the needle.
+             * @param type_id Element type identifier.
+             * @param indices Receives start indices (may be nullptr).
+             * @param match_count Receives the number of occurrences.
+             * @return int 0 on success, negative on error.
+             */
+            static int subsequence_all(
+            const void *base,
+            size_t count,
+            const void *needle,
+            size_t needle_count,
+            const std::string &type_id,
+            size_t *indices,
+            size_t *match_count
+            ) {
+                return fossil_algorithm_search_subsequence_all(
+                    base, count, needle, needle_count, type_id.c_str(), indices, match_count);
+            }
+
+        };
+
+        /**
+         * @brief RAII wrapper for a finger-search cursor.
+         *
+         * Owns a fossil_algorithm_search_cursor_t and releases it on
+         * destruction. Movable but not copyable; the searched array is
+         * borrowed, not copied.
+         */
+        class SearchCursor
+        {
+        public:
+            /**
+             * @brief Creates a cursor over a sorted array.
+             *
+             * @param base Pointer to the sorted array.
+             * @param count Number of elements in the array.
+             * @param type_id Type identifier.
+             * @param order_id Sort order of the array.
+             */
+            SearchCursor(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &order_id = "asc"
+            ) : cursor_(fossil_algorithm_search_cursor_create(base, count, type_id.c_str(), order_id.c_str())) {}
+
+            ~SearchCursor() { fossil_algorithm_search_cursor_destroy(cursor_); }
+
+            SearchCursor(const SearchCursor &) = delete;
+            SearchCursor &operator=(const SearchCursor &) = delete;
+
+            SearchCursor(SearchCursor &&other) noexcept : cursor_(other.cursor_) { other.cursor_ = nullptr; }
+
+            SearchCursor &operator=(SearchCursor &&other) noexcept {
+                if (this != &other) {
+                    fossil_algorithm_search_cursor_destroy(cursor_);
+                    cursor_ = other.cursor_;
+                    other.cursor_ = nullptr;
+                }
+                return *this;
+            }
+
+            /** @brief True when the cursor was created successfully. */
+            bool valid() const { return cursor_ != nullptr; }
+
+            /** @brief Finds a key; see fossil_algorithm_search_cursor_find. */
+            int find(const void *key) { return fossil_algorithm_search_cursor_find(cursor_, key); }
+
+            /** @brief Current position (last lower bound). */
+            size_t position() const { return fossil_algorithm_search_cursor_position(cursor_); }
+
+            /** @brief Moves the cursor; see fossil_algorithm_search_cursor_seek. */
+            void seek(size_t position) { fossil_algorithm_search_cursor_seek(cursor_, position); }
+
+        private:
+            fossil_algorithm_search_cursor_t *cursor_;
+        };
+
+        /**
+         * @brief RAII wrapper for a multi-pattern matcher.
+         *
+         * Owns a fossil_algorithm_search_patterns_t and releases it on
+         * destruction. Movable but not copyable.
+         */
+        class SearchPatterns
+        {
+        public:
+            /**
+             * @brief Builds a matcher for a set of needles.
+             *
+             * @param patterns Array of needle pointers.
+             * @param lengths Element count of each needle.
+             * @param pattern_count Number of needles.
+             * @param type_id Element type identifier.
+             */
+            SearchPatterns(
+            const void *const *patterns,
+            const size_t *lengths,
+            size_t pattern_count,
+            const std::string &type_id
+            ) : set_(fossil_algorithm_search_patterns_create(patterns, lengths, pattern_count, type_id.c_str())) {}
+
+            ~SearchPatterns() { fossil_algorithm_search_patterns_destroy(set_); }
+
+            SearchPatterns(const SearchPatterns &) = delete;
+            SearchPatterns &operator=(const SearchPatterns &) = delete;
+
+            SearchPatterns(SearchPatterns &&other) noexcept : set_(other.set_) { other.set_ = nullptr; }
+
+            SearchPatterns &operator=(SearchPatterns &&other) noexcept {
+                if (this != &other) {
+                    fossil_algorithm_search_patterns_destroy(set_);
+                    set_ = other.set_;
+                    other.set_ = nullptr;
+                }
+                return *this;
+            }
+
+            /** @brief True when the matcher was built successfully. */
+            bool valid() const { return set_ != nullptr; }
+
+            /** @brief Leftmost match; see fossil_algorithm_search_patterns_find. */
+            int find(const void *base, size_t count, size_t *pattern = nullptr) const {
+                return fossil_algorithm_search_patterns_find(set_, base, count, pattern);
+            }
+
+            /** @brief Every match; see fossil_algorithm_search_patterns_find_all. */
+            int find_all(
+            const void *base,
+            size_t count,
+            size_t *indices,
+            size_t *pattern_ids,
+            size_t capacity,
+            size_t *match_count
+            ) const {
+                return fossil_algorithm_search_patterns_find_all(
+                    set_, base, count, indices, pattern_ids, capacity, match_count);
+            }
+
+        private:
+            fossil_algorithm_search_patterns_t *set_;
+        };
+
+        /**
+         * @brief RAII wrapper for a membership filter.
+         *
+         * Owns a fossil_algorithm_search_filter_t and releases it on
+         * destruction. Movable but not copyable.
+         */
+        class SearchFilter
+        {
+        public:
+            /**
+             * @brief Builds a filter over the values of an array.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements in the array.
+             * @param type_id Fixed-width type identifier or "cstr".
+             * @param method_id "bloom" or "xor".
+             * @param bits_per_key Bloom budget per key (0 = default).
+             */
+            SearchFilter(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &method_id = "bloom",
+            double bits_per_key = 0.0
+            ) : filter_(fossil_algorithm_search_filter_create(base, count, type_id.c_str(), method_id.c_str(), bits_per_key)) {}
+
+            ~SearchFilter() { fossil_algorithm_search_filter_destroy(filter_); }
+
+            SearchFilter(const SearchFilter &) = delete;
+            SearchFilter &operator=(const SearchFilter &) = delete;
+
+            SearchFilter(SearchFilter &&other) noexcept : filter_(other.filter_) { other.filter_ = nullptr; }
+
+            SearchFilter &operator=(SearchFilter &&other) noexcept {
+                if (this != &other) {
+                    fossil_algorithm_search_filter_destroy(filter_);
+                    filter_ = other.filter_;
+                    other.filter_ = nullptr;
+                }
+                return *this;
+            }
+
+            /** @brief True when the filter was built successfully. */
+            bool valid() const { return filter_ != nullptr; }
+
+            /** @brief False when the key is definitely absent. */
+            bool contains(const void *key) const { return fossil_algorithm_search_filter_contains(filter_, key); }
+
+            /** @brief Size and accuracy; see fossil_algorithm_search_filter_stats. */
+            int stats(fossil_algorithm_search_filter_stats_t &out) const {
+                return fossil_algorithm_search_filter_stats(filter_, &out);
+            }
+
+            /** @brief Filtered search; see fossil_algorithm_search_exec_filtered. */
+            int exec(
+            const void *base,
+            size_t count,
+            const void *key,
+            const std::string &type_id,
+            const std::string &algorithm_id = "auto",
+            const std::string &order_id = "asc"
+            ) const {
+                return fossil_algorithm_search_exec_filtered(
+                    filter_, base, count, key, type_id.c_str(), algorithm_id.c_str(), order_id.c_str());
+            }
+
+        private:
+            fossil_algorithm_search_filter_t *filter_;
         };
 
     } // namespace bluecrab
@@ -0,0 +1,312 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_ALGORITHM_SKETCH_H
+#define FOSSIL_ALGORITHM_SKETCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ======================================================
+// Fossil Algorithm Sketch — Streaming Quantiles
+// ======================================================
+
+/**
+ * @brief Opaque streaming quantile sketch.
+ *
+ * A sketch answers quantile queries (p50, p95, p99, ...) over a stream of
+ * numeric values in one pass and bounded memory, instead of sorting a full
+ * copy of the data. Methods:
+ *   - "kll": KLL compactor hierarchy. Rank error is about 1.65 / k with
+ *     memory O(k log(n / k)); @p accuracy is k (default 200).
+ *   - "tdigest": merging t-digest. Error is relative to q(1 - q), so the
+ *     tails (p99, p999) are much tighter than the median; memory is
+ *     O(delta); @p accuracy is the compression delta (default 100).
+ *
+ * Up to FOSSIL_ALGORITHM_SKETCH_EXACT_MAX values are kept verbatim and
+ * queries on them are exact, so small inputs never pay for approximation.
+ *
+ * Values are accepted for the numeric type identifiers ("i8" .. "u64",
+ * "f32", "f64", "size", "datetime", "duration", "hex", "oct", "bin") and
+ * converted to double; NaN values are ignored. A sketch is not thread-safe;
+ * build one per thread and combine them with
+ * @ref fossil_algorithm_sketch_merge.
+ */
+typedef struct fossil_algorithm_sketch fossil_algorithm_sketch_t;
+
+/**
+ * @brief Number of values a sketch keeps verbatim before approximating.
+ */
+#define FOSSIL_ALGORITHM_SKETCH_EXACT_MAX 1024
+
+/**
+ * @brief Creates an empty sketch.
+ *
+ * Example:
+ * @code
+ * fossil_algorithm_sketch_t *sk = fossil_algorithm_sketch_create("f64", "tdigest", 0);
+ * fossil_algorithm_sketch_add_many(sk, latencies, n);
+ * double p99;
+ * fossil_algorithm_sketch_quantile(sk, 0.99, &p99);
+ * fossil_algorithm_sketch_destroy(sk);
+ * @endcode
+ *
+ * @param type_id Numeric type identifier of the values that will be added.
+ * @param method_id "kll" or "tdigest".
+ * @param accuracy k for "kll", delta for "tdigest" (0 picks the default).
+ * @return Pointer to the sketch, or NULL for an unknown type or method or
+ *         on allocation failure.
+ */
+fossil_algorithm_sketch_t *fossil_algorithm_sketch_create(
+    const char *type_id,
+    const char *method_id,
+    size_t accuracy
+);
+
+/**
+ * @brief Releases a sketch and all of its storage. Accepts NULL.
+ */
+void fossil_algorithm_sketch_destroy(fossil_algorithm_sketch_t *sk);
+
+/**
+ * @brief Adds one value.
+ *
+ * @return `0` on success, `-1` for invalid input, `-4` on allocation failure.
+ */
+int fossil_algorithm_sketch_add(fossil_algorithm_sketch_t *sk, const void *elem);
+
+/**
+ * @brief Adds an array of values of the sketch's type.
+ *
+ * @return `0` on success, `-1` for invalid input, `-4` on allocation failure.
+ */
+int fossil_algorithm_sketch_add_many(fossil_algorithm_sketch_t *sk, const void *elems, size_t count);
+
+/**
+ * @brief Folds another sketch into @p sk.
+ *
+ * Both sketches must use the same method and accuracy; their value types
+ * may differ. @p other is left unchanged.
+ *
+ * @return `0` on success, `-1` for invalid input, `-3` if the sketches are
+ *         incompatible, `-4` on allocation failure.
+ */
+int fossil_algorithm_sketch_merge(fossil_algorithm_sketch_t *sk, const fossil_algorithm_sketch_t *other);
+
+/**
+ * @brief Estimates the value at quantile @p q.
+ *
+ * q = 0 and q = 1 return the exact minimum and maximum. While the sketch is
+ * exact the result is the nearest-rank value (the smallest value with at
+ * least q * n values at or below it).
+ *
+ * @param sk Sketch to query (queries may reorder internal buffers).
+ * @param q Quantile in [0, 1].
+ * @param out Output for the estimate.
+ * @return `0` on success, `-1` for invalid input, `-2` if the sketch is
+ *         empty, `-4` on allocation failure.
+ */
+int fossil_algorithm_sketch_quantile(fossil_algorithm_sketch_t *sk, double q, double *out);
+
+/**
+ * @brief Estimates several quantiles at once.
+ *
+ * Cheaper than repeated @ref fossil_algorithm_sketch_quantile calls because
+ * the sketch is flattened only once.
+ *
+ * @return `0` on success, `-1` for invalid input, `-2` if the sketch is
+ *         empty, `-4` on allocation failure.
+ */
+int fossil_algorithm_sketch_quantiles(
+    fossil_algorithm_sketch_t *sk,
+    const double *qs,
+    size_t count,
+    double *out
+);
+
+/**
+ * @brief Returns the number of values added, including merged ones (0 for NULL).
+ */
+size_t fossil_algorithm_sketch_count(const fossil_algorithm_sketch_t *sk);
+
+/**
+ * @brief True while the sketch still holds every value verbatim.
+ */
+bool fossil_algorithm_sketch_is_exact(const fossil_algorithm_sketch_t *sk);
+
+/**
+ * @brief Removes every value while keeping the method and accuracy.
+ */
+void fossil_algorithm_sketch_clear(fossil_algorithm_sketch_t *sk);
+
+/**
+ * @brief One-shot quantiles of an array.
+ *
+ * Builds a sketch over @p base in a single pass and reads the requested
+ * quantiles. Arrays of at most FOSSIL_ALGORITHM_SKETCH_EXACT_MAX elements
+ * get exact answers.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Numeric type identifier.
+ * @param method_id "kll" or "tdigest".
+ * @param qs Quantiles to read, each in [0, 1].
+ * @param q_count Number of quantiles.
+ * @param out Output array of @p q_count estimates.
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` if the array holds no (non-NaN) values
+ *   - `-3` for an unknown type or method
+ *   - `-4` on allocation failure
+ */
+int fossil_algorithm_sketch_exec(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *method_id,
+    const double *qs,
+    size_t q_count,
+    double *out
+);
+
+#ifdef __cplusplus
+}
+
+#include <string>
+
+namespace fossil {
+
+    namespace algorithm {
+
+        /**
+         * @brief RAII wrapper for the Fossil quantile sketch.
+         *
+         * Owns a fossil_algorithm_sketch_t and releases it on destruction.
+         * The sketch is movable but not copyable. All methods forward to the
+         * C API and return its status codes unchanged.
+         */
+        class Sketch
+        {
+        public:
+            /**
+             * @brief Creates a sketch for the given type and method.
+             *
+             * @param type_id Numeric type identifier (e.g., "i64", "f64").
+             * @param method_id "kll" or "tdigest".
+             * @param accuracy k or delta (0 picks the default).
+             */
+            explicit Sketch(
+            const std::string &type_id,
+            const std::string &method_id = "kll",
+            size_t accuracy = 0
+            ) : sk_(fossil_algorithm_sketch_create(type_id.c_str(), method_id.c_str(), accuracy)) {}
+
+            ~Sketch() { fossil_algorithm_sketch_destroy(sk_); }
+
+            Sketch(const Sketch &) = delete;
+            Sketch &operator=(const Sketch &) = delete;
+
+            Sketch(Sketch &&other) noexcept : sk_(other.sk_) { other.sk_ = nullptr; }
+
+            Sketch &operator=(Sketch &&other) noexcept {
+                if (this != &other) {
+                    fossil_algorithm_sketch_destroy(sk_);
+                    sk_ = other.sk_;
+                    other.sk_ = nullptr;
+                }
+                return *this;
+            }
+
+            /** @brief True when the sketch was created successfully. */
+            bool valid() const { return sk_ != nullptr; }
+
+            /** @brief Adds one value; see fossil_algorithm_sketch_add. */
+            int add(const void *elem) {
+                return fossil_algorithm_sketch_add(sk_, elem);
+            }
+
+            /** @brief Adds an array; see fossil_algorithm_sketch_add_many. */
+            int add_many(const void *elems, size_t count) {
+                return fossil_algorithm_sketch_add_many(sk_, elems, count);
+            }
+
+            /** @brief Folds another sketch in; see fossil_algorithm_sketch_merge. */
+            int merge(const Sketch &other) {
+                return fossil_algorithm_sketch_merge(sk_, other.sk_);
+            }
+
+            /** @brief Estimates one quantile; see fossil_algorithm_sketch_quantile. */
+            int quantile(double q, double *out) {
+                return fossil_algorithm_sketch_quantile(sk_, q, out);
+            }
+
+            /** @brief Estimates several quantiles; see fossil_algorithm_sketch_quantiles. */
+            int quantiles(const double *qs, size_t count, double *out) {
+                return fossil_algorithm_sketch_quantiles(sk_, qs, count, out);
+            }
+
+            /** @brief Number of values added. */
+            size_t count() const { return fossil_algorithm_sketch_count(sk_); }
+
+            /** @brief True while every value is held verbatim. */
+            bool exact() const { return fossil_algorithm_sketch_is_exact(sk_); }
+
+            /** @brief Removes every value. */
+            void clear() { fossil_algorithm_sketch_clear(sk_); }
+
+            /**
+             * @brief One-shot quantiles of an array; see fossil_algorithm_sketch_exec.
+             */
+            static int exec(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            const double *qs,
+            size_t q_count,
+            double *out,
+            const std::string &method_id = "kll"
+            ) {
+                return fossil_algorithm_sketch_exec(
+                    base, count, type_id.c_str(), method_id.c_str(), qs, q_count, out);
+            }
+
+        private:
+            fossil_algorithm_sketch_t *sk_;
+        };
+
+    } // namespace algorithm
+
+} // namespace fossil
+
+#endif
+
+#endif /* FOSSIL_ALGORITHM_SKETCH_H */
@@ -44,8 +44,9 @@ extern "C" {
  *
  * This function provides a flexible runtime interface for sorting arrays of
  * various types, using the algorithm, order, and type specified by string
- * identifiers. It supports multiple algorithms (merge, heap, insertion, shell,
- * bubble, counting, radix) and both ascending and descending order.
+ * identifiers. It supports multiple algorithms (quick, merge, heap, insertion,
+ * shell, bubble, counting, radix, flash) and both ascending and descending
+ * order.
  *
  * Internally, the function dispatches to the appropriate algorithm stub based
  * on the algorithm_id string. Type safety is managed via type_id and a
@@ -53,8 +54,26 @@ extern "C" {
  * returned.
  *
  * Notes:
- *   - "auto" algorithm_id defaults to merge sort.
- *   - Counting sort only supports "u8" type; radix sort only supports "u32".
+ *   - "auto" algorithm_id picks an engine per call: counting sort for 8-bit
+ *     types, range-narrowed counting/radix sort for integers, a hash-count
+ *     sort when a sample shows few distinct keys, three-way quicksort for
+ *     other fixed-width types, and stable merge sort for "cstr". Before any
+ *     of them it scans the input for runs: sorted input returns after one
+ *     pass, reversed or few-run input is finished by a natural merge, and a
+ *     sorted prefix with a short unsorted tail only sorts the tail.
+ *   - "quick" is an introsort with three-way partitioning, so runs of equal
+ *     keys cost nothing extra; it falls back to heap sort on bad pivots.
+ *     Fixed-width types partition branch-free through a scratch copy of the
+ *     input, or in place when that allocation fails.
+ *   - With "auto" or "merge", inputs of up to 64 elements take an
+ *     allocation-free fast path: a sorting network for up to 32 fixed-width
+ *     elements, insertion sort otherwise.
+ *   - Counting sort supports integer types whose values span at most 65536
+ *     distinct keys; radix sort supports all integer types.
+ *   - Integer keys are rebased against their minimum before counting or
+ *     radix sorting, so a 64-bit column that spans a small range (for
+ *     example datetimes inside one day) is sorted as u16/u32 keys. "auto"
+ *     applies this narrowing whenever it reaches a smaller key width.
  *   - Returns negative error codes for invalid input, unknown type, or unknown algorithm.
  *   - Sorting is performed in-place.
  *
@@ -104,15 +123,803 @@ size_t fossil_algorithm_sort_type_sizeof(const char *type_id);
  */
 bool fossil_algorithm_sort_type_supported(const char *type_id);
 
+// ======================================================
+// Sorting Networks
+// ======================================================
+
+/**
+ * @brief Largest element count handled by the sorting network API.
+ */
+#define FOSSIL_ALGORITHM_SORT_NETWORK_MAX 32
+
+/**
+ * @brief Sorts up to 32 elements with a fixed, branchless sorting network.
+ *
+ * Each size from 2 to 32 has its own precomputed Batcher odd-even merge
+ * network, so the work is a fixed sequence of compare-exchange steps that
+ * compile to min/max or conditional moves. This avoids the allocation and
+ * recursion of the general engines and suits workloads that sort many tiny
+ * groups (top-4 per row, median of 5, ...).
+ *
+ * Only fixed-width type identifiers are supported; "cstr" returns -2.
+ *
+ * Example:
+ * @code
+ * int32_t row[5] = { 9, 2, 7, 4, 1 };
+ * fossil_algorithm_sort_network(row, 5, "i32", "asc");
+ * @endcode
+ *
+ * @param base Pointer to the array to sort.
+ * @param count Number of elements (0 to FOSSIL_ALGORITHM_SORT_NETWORK_MAX).
+ * @param type_id String identifier for data type (e.g., "i32", "f64").
+ * @param order_id String identifier for sort order ("asc", "desc").
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` for unknown or non fixed-width type
+ *   - `-4` if count exceeds FOSSIL_ALGORITHM_SORT_NETWORK_MAX
+ */
+int fossil_algorithm_sort_network(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id
+);
+
+/**
+ * @brief Typed sorting network entry points.
+ *
+ * Same networks as @ref fossil_algorithm_sort_network without any string
+ * resolution, for hot loops that already know the element type.
+ *
+ * @param base Pointer to the array to sort.
+ * @param count Number of elements (0 to FOSSIL_ALGORITHM_SORT_NETWORK_MAX).
+ * @param desc True for descending order.
+ * @return int `0` on success, `-1` for NULL base or count out of range.
+ */
+int fossil_algorithm_sort_network_i8(int8_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_i16(int16_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_i32(int32_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_i64(int64_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_u8(uint8_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_u16(uint16_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_u32(uint32_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_u64(uint64_t *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_f32(float *base, size_t count, bool desc);
+int fossil_algorithm_sort_network_f64(double *base, size_t count, bool desc);
+
+// ======================================================
+// Distribution (flash) sort
+// ======================================================
+
+/**
+ * @brief Cumulative distribution function used by the flash sort.
+ *
+ * Maps a key to its estimated rank fraction in [0, 1]. The function must be
+ * non-decreasing in @p value; results outside [0, 1] are clamped.
+ *
+ * @param value Key converted to double.
+ * @param context Caller-supplied context pointer.
+ * @return double Estimated fraction of keys less than or equal to @p value.
+ */
+typedef double (*fossil_algorithm_sort_cdf_fn)(double value, void *context);
+
+/**
+ * @brief Sorts numeric data by distributing it into buckets along a CDF.
+ *
+ * One pass classifies every key into one of about count/8 buckets using
+ * @p cdf, the buckets are laid out contiguously, and each one is finished
+ * with a sorting network (or introsort when a bucket runs long). Data that
+ * follows the distribution sorts in near-linear time; a poor CDF only costs
+ * speed, never correctness.
+ *
+ * When @p cdf is NULL the distribution is estimated from a sorted sample of
+ * up to 1024 keys, which is what the "flash" algorithm_id of
+ * @ref fossil_algorithm_sort_exec does.
+ *
+ * Example:
+ * @code
+ * // Readings known to be uniform on [0, 100).
+ * static double uniform_cdf(double v, void *ctx) { (void)ctx; return v / 100.0; }
+ * fossil_algorithm_sort_flash(readings, n, "f64", "asc", uniform_cdf, NULL);
+ * @endcode
+ *
+ * @param base Pointer to the array to sort.
+ * @param count Number of elements.
+ * @param type_id Fixed-width numeric type identifier (e.g., "f32", "u64").
+ * @param order_id String identifier for sort order ("asc", "desc").
+ * @param cdf Distribution of the keys, or NULL to sample it.
+ * @param context Passed through to @p cdf.
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` for unknown or non fixed-width type
+ *   - `-5` if scratch memory could not be allocated
+ */
+int fossil_algorithm_sort_flash(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id,
+    fossil_algorithm_sort_cdf_fn cdf,
+    void *context
+);
+
+// ======================================================
+// Predicate partitioning and filtering
+// ======================================================
+
+/**
+ * @brief Stable partition by a built-in predicate.
+ *
+ * Moves every element that satisfies the predicate to the front and every
+ * other element behind it, both sides keeping their input order. The loop
+ * evaluates the predicate without data-dependent branches (both sides are
+ * written and only one cursor advances), so selectivity near 50% costs no
+ * mispredictions. The quick sort engine partitions with the same kernel.
+ *
+ * Predicates (@p lo and @p hi point to a value of the array's type):
+ *   - "eq", "ne", "lt", "le", "gt", "ge": compare against *lo.
+ *   - "range": *lo <= x && x <= *hi.
+ *   - "mask": @p lo is a bitmap, element i matches when bit (i % 8) of
+ *     byte (i / 8) is set; @p hi is ignored.
+ *
+ * Example:
+ * @code
+ * int32_t limit = 100;
+ * size_t hits = 0;
+ * fossil_algorithm_sort_partition_if(values, n, "i32", "lt", &limit, NULL, &hits);
+ * // values[0 .. hits) are < 100, in their original order.
+ * @endcode
+ *
+ * @param base Pointer to the array to partition in place.
+ * @param count Number of elements.
+ * @param type_id Fixed-width type identifier (e.g., "i32", "f64").
+ * @param predicate_id Predicate identifier (see above).
+ * @param lo Predicate operand, or bitmap for "mask".
+ * @param hi Upper bound for "range" (may be NULL otherwise).
+ * @param matched Optional output for the number of matching elements.
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` for unknown or non fixed-width type
+ *   - `-3` for unknown predicate
+ *   - `-5` if scratch memory could not be allocated
+ */
+int fossil_algorithm_sort_partition_if(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *matched
+);
+
+/**
+ * @brief Compacts the elements that satisfy a predicate into @p out.
+ *
+ * Same predicates as @ref fossil_algorithm_sort_partition_if. Matching
+ * elements are written to the front of @p out in input order. @p out needs
+ * room for @p count elements (the branch-free store writes one slot past
+ * the current match) and may equal @p base for in-place compaction.
+ *
+ * @param base Pointer to the input array.
+ * @param out Destination array of at least @p count elements.
+ * @param count Number of elements.
+ * @param type_id Fixed-width type identifier.
+ * @param predicate_id Predicate identifier.
+ * @param lo Predicate operand, or bitmap for "mask".
+ * @param hi Upper bound for "range" (may be NULL otherwise).
+ * @param matched Optional output for the number of elements written.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type,
+ *         -3 unknown predicate).
+ */
+int fossil_algorithm_sort_filter(
+    const void *base,
+    void *out,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *matched
+);
+
+// ======================================================
+// Radix / hash partitioning
+// ======================================================
+
+/**
+ * @brief Largest number of partition bits accepted by the partition API.
+ */
+#define FOSSIL_ALGORITHM_SORT_PARTITION_MAX_BITS 16
+
+/**
+ * @brief Scatters keys (and optional payloads) into 2^bits partitions.
+ *
+ * This is the first pass of a partitioned hash join, group-by or MSD radix
+ * sort. A histogram pass counts every partition, prefix sums turn the counts
+ * into offsets, and a scatter pass writes each partition contiguously into
+ * @p out. Rows keep their input order inside a partition (the scatter is
+ * stable). Writes go through small per-partition write-combining buffers so
+ * that a large fan-out does not thrash the TLB.
+ *
+ * Methods:
+ *   - "radix": partition = (key >> shift) & (2^bits - 1), where key is the
+ *     order-preserving unsigned image of the value (sign bit flipped for
+ *     signed integers, IEEE bits adjusted for floats), so partitions come
+ *     out in ascending key order.
+ *   - "hash": partition = top @p bits of a 64-bit mix of the key; @p shift
+ *     is ignored. Use this when the key distribution is skewed.
+ *
+ * With @p threads > 1 the input is split into that many chunks; both passes
+ * run on all of them in parallel and the output is identical to the
+ * single-threaded one.
+ *
+ * Example:
+ * @code
+ * size_t offsets[(1u << 8) + 1];
+ * fossil_algorithm_sort_partition(keys, keys_out, n, "u64", rows, rows_out,
+ *                                 sizeof(row_t), "hash", 8, 0, offsets, 4);
+ * // Partition p is keys_out[offsets[p] .. offsets[p + 1]).
+ * @endcode
+ *
+ * @param base Keys to partition.
+ * @param out Destination for the partitioned keys (must not alias @p base).
+ * @param count Number of keys.
+ * @param type_id Fixed-width key type identifier (e.g., "i32", "f64").
+ * @param payload Optional per-key payload rows, or NULL.
+ * @param payload_out Destination for payload rows (NULL when @p payload is).
+ * @param payload_size Size of one payload row in bytes.
+ * @param method_id Partitioning method ("radix" or "hash").
+ * @param bits Number of partition bits (0 to FOSSIL_ALGORITHM_SORT_PARTITION_MAX_BITS).
+ * @param shift Low bit of the radix digit (ignored for "hash").
+ * @param offsets Output array of 2^bits + 1 partition start offsets; the
+ *        last entry equals @p count.
+ * @param threads Number of worker threads (0 or 1 runs on the caller).
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` for unknown or non fixed-width type
+ *   - `-3` for unknown method
+ *   - `-4` if bits or shift are out of range
+ *   - `-5` if scratch memory could not be allocated
+ */
+int fossil_algorithm_sort_partition(
+    const void *base,
+    void *out,
+    size_t count,
+    const char *type_id,
+    const void *payload,
+    void *payload_out,
+    size_t payload_size,
+    const char *method_id,
+    unsigned bits,
+    unsigned shift,
+    size_t *offsets,
+    size_t threads
+);
+
+// ======================================================
+// Unique and run-length encoding
+// ======================================================
+
+/**
+ * @brief Removes adjacent duplicates from a sorted array in place.
+ *
+ * The first element of every run of equal values is kept and the survivors
+ * are packed to the front of @p base in their original order. Equality is
+ * `==` for fixed-width numeric types (so NaN values never merge) and the
+ * type's comparator otherwise. The input only needs equal values to be
+ * adjacent; ascending and descending arrays both work.
+ *
+ * @param base Pointer to the sorted array.
+ * @param count Number of elements.
+ * @param type_id Type identifier (e.g., "i32", "cstr").
+ * @param unique_count Output for the number of elements kept.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type).
+ */
+int fossil_algorithm_sort_unique(
+    void *base,
+    size_t count,
+    const char *type_id,
+    size_t *unique_count
+);
+
+/**
+ * @brief Counts the distinct values of a sorted array without modifying it.
+ *
+ * @param base Pointer to the sorted array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param unique_count Output for the number of distinct values.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type).
+ */
+int fossil_algorithm_sort_unique_count(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    size_t *unique_count
+);
+
+/**
+ * @brief Sorts an array and removes duplicates in one call.
+ *
+ * With "auto" (or NULL) the dedup is fused into the final output pass of
+ * the counting, narrowed radix and low-cardinality engines, so duplicates
+ * are never written back. Any other algorithm sorts first and then runs
+ * @ref fossil_algorithm_sort_unique.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param algorithm_id Sorting algorithm identifier, or NULL for "auto".
+ * @param order_id "asc" or "desc" (NULL means "asc").
+ * @param unique_count Output for the number of elements kept.
+ * @return int Status code (0 on success, otherwise the sort's error code).
+ */
+int fossil_algorithm_sort_exec_unique(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id,
+    size_t *unique_count
+);
+
+/**
+ * @brief Run-length encodes an array.
+ *
+ * Each maximal run of equal adjacent values becomes one entry in @p values
+ * and its length in @p lengths. Either output may be NULL; with both NULL
+ * only @p run_count is computed, which is how callers size the buffers.
+ *
+ * @param base Pointer to the input array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param values Optional output for one value per run.
+ * @param lengths Optional output for one length per run.
+ * @param run_count Output for the number of runs.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type).
+ */
+int fossil_algorithm_sort_rle_encode(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    void *values,
+    size_t *lengths,
+    size_t *run_count
+);
+
+/**
+ * @brief Expands a run-length encoding back into an array.
+ *
+ * @p out_count always receives the decoded length. With @p out NULL
+ * nothing else is written.
+ *
+ * @param values Run values.
+ * @param lengths Run lengths.
+ * @param run_count Number of runs.
+ * @param type_id Type identifier.
+ * @param out Destination array, or NULL to size only.
+ * @param capacity Number of elements @p out can hold.
+ * @param out_count Output for the decoded length.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type,
+ *         -4 if @p capacity is too small).
+ */
+int fossil_algorithm_sort_rle_decode(
+    const void *values,
+    const size_t *lengths,
+    size_t run_count,
+    const char *type_id,
+    void *out,
+    size_t capacity,
+    size_t *out_count
+);
+
+// ======================================================
+// Group-by aggregation
+// ======================================================
+
+/**
+ * @brief Per-group aggregates produced by @ref fossil_algorithm_sort_group_by.
+ *
+ * Values are accumulated as double. Without a value array only @c count is
+ * filled and the other fields are zero.
+ */
+typedef struct fossil_algorithm_sort_group_t {
+    size_t count;   ///< Rows in the group.
+    double sum;     ///< Sum of the group's values.
+    double min;     ///< Smallest value in the group.
+    double max;     ///< Largest value in the group.
+} fossil_algorithm_sort_group_t;
+
+/**
+ * @brief Groups rows by key and aggregates their values.
+ *
+ * Emits each distinct key once, in key order, together with the count, sum,
+ * min and max of the values on its rows. The sorted key/value pairs are
+ * never materialised:
+ *   - integer keys whose range is smaller than @p count aggregate directly
+ *     into a table indexed by key;
+ *   - low-cardinality keys (detected by sampling) aggregate in one hash table;
+ *   - anything else is radix-partitioned on the key, most significant bits
+ *     first, until each partition fits a small hash table.
+ *
+ * Keys group by bit pattern, so for floating-point keys -0.0 and 0.0 are
+ * separate groups and NaN keys group with identical NaNs (after +inf).
+ *
+ * Example:
+ * @code
+ * int32_t store[]  = {3, 1, 3, 2, 1};
+ * double  amount[] = {5, 2, 1, 7, 4};
+ * int32_t ids[5];
+ * fossil_algorithm_sort_group_t sums[5];
+ * size_t groups;
+ * fossil_algorithm_sort_group_by(store, amount, 5, "i32", "f64", "asc",
+ *                                ids, sums, &groups);
+ * // groups == 3; ids = {1, 2, 3}; sums[0].sum == 6.0, sums[2].count == 2
+ * @endcode
+ *
+ * @param keys Key array.
+ * @param values Optional value array (one per key), or NULL to only count.
+ * @param count Number of rows.
+ * @param key_type_id Fixed-width key type identifier (e.g., "u32", "datetime").
+ * @param value_type_id Fixed-width numeric value type (ignored without values).
+ * @param order_id "asc" or "desc" key order (NULL means "asc").
+ * @param out_keys Output for the distinct keys (room for @p count keys).
+ * @param out_groups Output for the aggregates (room for @p count groups).
+ * @param group_count Output for the number of groups.
+ * @return int Status code:
+ *   - `0` on success
+ *   - `-1` for invalid input
+ *   - `-2` for unknown or non fixed-width key or value type
+ *   - `-5` if scratch memory could not be allocated
+ */
+int fossil_algorithm_sort_group_by(
+    const void *keys,
+    const void *values,
+    size_t count,
+    const char *key_type_id,
+    const char *value_type_id,
+    const char *order_id,
+    void *out_keys,
+    fossil_algorithm_sort_group_t *out_groups,
+    size_t *group_count
+);
+
+// ======================================================
+// Selection and exact quantiles
+// ======================================================
+
+/**
+ * @brief Places several order statistics at their sorted positions.
+ *
+ * After the call, base[r] holds the element a full sort would put there for
+ * every r in @p ranks, and every element before (after) it is ordered
+ * before (after) it, like a multi-rank nth_element. One recursive
+ * multi-select serves all ranks: introselect with Floyd-Rivest pivots on
+ * the same three-way partition engine as "quick", so m ranks cost
+ * O(n log m) instead of the O(n log n) of a full sort.
+ *
+ * @param base Pointer to the array (reordered in place).
+ * @param count Number of elements.
+ * @param type_id Fixed-width type identifier (e.g., "i32", "f64", "datetime").
+ * @param ranks Zero-based ranks to place, in any order (duplicates allowed).
+ * @param rank_count Number of ranks.
+ * @param order_id "asc" or "desc" (NULL means "asc").
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown or
+ *         non fixed-width type, -4 rank out of range, -5 out of memory).
+ */
+int fossil_algorithm_sort_select(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const size_t *ranks,
+    size_t rank_count,
+    const char *order_id
+);
+
+/**
+ * @brief Exact quantiles by multi-selection.
+ *
+ * For each q the nearest-rank value is written to @p out: the smallest
+ * element with at least q * count elements at or below it (q = 0 gives the
+ * minimum, q = 1 the maximum). All quantiles are selected in one pass
+ * of @ref fossil_algorithm_sort_select.
+ *
+ * Example:
+ * @code
+ * double qs[] = {0.5, 0.95, 0.99};
+ * uint32_t p[3];
+ * fossil_algorithm_sort_quantiles(latency_us, n, "u32", qs, 3, p, false);
+ * @endcode
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Fixed-width type identifier.
+ * @param qs Quantiles, each in [0, 1].
+ * @param q_count Number of quantiles.
+ * @param out Output array of @p q_count elements of the input type.
+ * @param in_place true to reorder @p base directly, false to work on a copy
+ *        and leave @p base untouched.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown or
+ *         non fixed-width type, -4 if a quantile is outside [0, 1] or the
+ *         array is empty, -5 out of memory).
+ */
+int fossil_algorithm_sort_quantiles(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const double *qs,
+    size_t q_count,
+    void *out,
+    bool in_place
+);
+
+/**
+ * @brief Exact (lower) median; shorthand for the 0.5 quantile.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Fixed-width type identifier.
+ * @param out Output for one element of the input type.
+ * @param in_place true to reorder @p base, false to work on a copy.
+ * @return int Status code, as for @ref fossil_algorithm_sort_quantiles.
+ */
+int fossil_algorithm_sort_median(
+    void *base,
+    size_t count,
+    const char *type_id,
+    void *out,
+    bool in_place
+);
+
+// ======================================================
+// Sortedness
+// ======================================================
+
+/**
+ * @brief Presortedness measures filled by
+ *        @ref fossil_algorithm_sort_presortedness.
+ */
+typedef struct fossil_algorithm_sort_sortedness_t {
+    size_t sorted_prefix;   /**< Length of the longest sorted prefix. */
+    size_t runs;            /**< Number of maximal sorted runs (1 when sorted). */
+    double inversion_ratio; /**< Sampled fraction of out-of-order pairs: 0 sorted, ~0.5 random, 1 reversed. */
+} fossil_algorithm_sort_sortedness_t;
+
+/**
+ * @brief Length of the longest prefix of @p base that is sorted in @p order_id.
+ *
+ * Equal neighbours count as sorted. Fixed-width types are checked a block
+ * at a time and stop at the first block that breaks order.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param order_id "asc" or "desc" (NULL means "asc").
+ * @return size_t Index of the first element out of order, @p count when the
+ *         whole array is sorted, or 0 for invalid input or an unknown type.
+ */
+size_t fossil_algorithm_sort_is_sorted_until(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id
+);
+
+/**
+ * @brief Checks whether @p base is sorted in @p order_id.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param order_id "asc" or "desc" (NULL means "asc").
+ * @return bool True if sorted (empty and one-element arrays are), false
+ *         otherwise or for invalid input.
+ */
+bool fossil_algorithm_sort_is_sorted(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id
+);
+
+/**
+ * @brief Cheap presortedness estimate.
+ *
+ * One pass counts the descents (runs - 1); the inversion ratio compares
+ * 1024 pseudo-random pairs, so the whole estimate costs about one
+ * comparison per element.
+ *
+ * @param base Pointer to the array.
+ * @param count Number of elements.
+ * @param type_id Type identifier.
+ * @param order_id "asc" or "desc" (NULL means "asc").
+ * @param out Receives the measures.
+ * @return int Status code (0 on success, -1 invalid input, -2 unknown type).
+ */
+int fossil_algorithm_sort_presortedness(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id,
+    fossil_algorithm_sort_sortedness_t *out
+);
+
 #ifdef __cplusplus
 }
 
+#include <array>
+#include <cstddef>
 #include <string>
 
 namespace fossil {
 
     namespace algorithm {
 
+        namespace detail {
+
+            /**
+             * @brief Branchless compare-exchange used by the network templates.
+             */
+            template <typename T>
+            constexpr void network_cas(T &a, T &b, bool desc) noexcept
+            {
+                bool s = desc ? (a < b) : (b < a);
+                T lo = s ? b : a;
+                T hi = s ? a : b;
+                a = lo;
+                b = hi;
+            }
+
+            /**
+             * @brief Batcher odd-even merge network for a compile-time size N.
+             *
+             * Produces the same comparator sequence as the C tables; with N
+             * known the loops fully unroll.
+             */
+            template <typename T, std::size_t N>
+            constexpr void network_sort(T *a, bool desc) noexcept
+            {
+                for (std::size_t p = 1; p < N; p <<= 1) {
+                    for (std::size_t k = p; k >= 1; k >>= 1) {
+                        for (std::size_t j = k % p; j + k < N; j += 2 * k) {
+                            for (std::size_t i = 0; i < k && i + j + k < N; ++i) {
+                                if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                                    network_cas(a[i + j], a[i + j + k], desc);
+                            }
+                        }
+                    }
+                }
+            }
+
+            /**
+             * @brief Default ordering for the compile-time helpers.
+             */
+            struct sort_less
+            {
+                template <typename A, typename B>
+                constexpr bool operator()(const A &a, const B &b) const noexcept { return a < b; }
+            };
+
+            /**
+             * @brief Iterative heap sort usable in constant expressions.
+             */
+            template <typename T, typename Less>
+            constexpr void static_heap_sort(T *a, std::size_t n, Less less)
+            {
+                if (n < 2)
+                    return;
+                auto sift = [&](std::size_t root, std::size_t end) {
+                    for (;;) {
+                        std::size_t child = 2 * root + 1;
+                        if (child >= end)
+                            break;
+                        if (child + 1 < end && less(a[child], a[child + 1]))
+                            ++child;
+                        if (!less(a[root], a[child]))
+                            break;
+                        T tmp = a[root];
+                        a[root] = a[child];
+                        a[child] = tmp;
+                        root = child;
+                    }
+                };
+                for (std::size_t i = n / 2; i-- > 0;)
+                    sift(i, n);
+                for (std::size_t end = n - 1; end > 0; --end) {
+                    T tmp = a[0];
+                    a[0] = a[end];
+                    a[end] = tmp;
+                    sift(0, end);
+                }
+            }
+
+        } // namespace detail
+
+        /**
+         * @brief Sorts a fixed-size C array with a sorting network.
+         *
+         * Usable in constant expressions, so small tables can be sorted at
+         * compile time.
+         *
+         * @tparam T Element type with a strict-weak-ordering operator<.
+         * @tparam N Number of elements (1 to FOSSIL_ALGORITHM_SORT_NETWORK_MAX).
+         * @param data Array to sort in place.
+         * @param desc True for descending order.
+         */
+        template <typename T, std::size_t N>
+        constexpr void sort_network(T (&data)[N], bool desc = false) noexcept
+        {
+            static_assert(N >= 1 && N <= FOSSIL_ALGORITHM_SORT_NETWORK_MAX,
+                          "sort_network supports 1 to 32 elements");
+            detail::network_sort<T, N>(data, desc);
+        }
+
+        /**
+         * @brief Returns a sorted copy of a std::array using a sorting network.
+         *
+         * @tparam T Element type with a strict-weak-ordering operator<.
+         * @tparam N Number of elements (1 to FOSSIL_ALGORITHM_SORT_NETWORK_MAX).
+         * @param data Array to sort (taken by value).
+         * @param desc True for descending order.
+         * @return The sorted array.
+         */
+        template <typename T, std::size_t N>
+        constexpr std::array<T, N> sort_network(std::array<T, N> data, bool desc = false) noexcept
+        {
+            static_assert(N >= 1 && N <= FOSSIL_ALGORITHM_SORT_NETWORK_MAX,
+                          "sort_network supports 1 to 32 elements");
+            detail::network_sort<T, N>(data.data(), desc);
+            return data;
+        }
+
+        /**
+         * @brief Returns a sorted copy of a std::array, usable at compile time.
+         *
+         * Intended for lookup tables that are known at build time (keyword
+         * tables, enum name maps, sorted constant sets): declare the result
+         * constexpr and the sorted table is emitted as read-only data, with no
+         * sorting at startup.
+         *
+         * @code
+         * constexpr auto primes = fossil::algorithm::static_sort(std::array<int, 5>{11, 2, 7, 3, 5});
+         * static_assert(fossil::algorithm::static_is_sorted(primes));
+         * @endcode
+         *
+         * @tparam T Element type.
+         * @tparam N Number of elements.
+         * @tparam Less Strict weak ordering; defaults to operator<.
+         * @param data Array to sort (taken by value).
+         * @param less Ordering predicate.
+         * @return The sorted array.
+         */
+        template <typename T, std::size_t N, typename Less = detail::sort_less>
+        constexpr std::array<T, N> static_sort(std::array<T, N> data, Less less = Less{})
+        {
+            detail::static_heap_sort(data.data(), N, less);
+            return data;
+        }
+
+        /**
+         * @brief Checks at compile time (or run time) that a std::array is sorted.
+         *
+         * @param data Array to check.
+         * @param less Ordering predicate; defaults to operator<.
+         * @return True if no element is ordered before its predecessor.
+         */
+        template <typename T, std::size_t N, typename Less = detail::sort_less>
+        constexpr bool static_is_sorted(const std::array<T, N> &data, Less less = Less{})
+        {
+            for (std::size_t i = 1; i < N; ++i)
+                if (less(data[i], data[i - 1]))
+                    return false;
+            return true;
+        }
+
         /**
          * @brief RAII-friendly C++ wrapper for Fossil sorting algorithms.
          *
@@ -176,6 +983,383 @@ namespace fossil {
             {
             return fossil_algorithm_sort_type_supported(type_id.c_str());
             }
+
+            /**
+             * @brief Sorts up to 32 elements with a sorting network.
+             *
+             * @param base Pointer to the array to sort.
+             * @param count Number of elements (0 to FOSSIL_ALGORITHM_SORT_NETWORK_MAX).
+             * @param type_id String identifier for data type (e.g., "i32", "f64").
+             * @param order_id String identifier for sort order ("asc", "desc").
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int network(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &order_id = "asc"
+            )
+            {
+            return fossil_algorithm_sort_network(base, count, type_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief Distribution sort along a caller-supplied or sampled CDF.
+             *
+             * @param base Pointer to the array to sort.
+             * @param count Number of elements.
+             * @param type_id Fixed-width numeric type identifier.
+             * @param order_id String identifier for sort order ("asc", "desc").
+             * @param cdf Distribution of the keys, or nullptr to sample it.
+             * @param context Passed through to @p cdf.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int flash(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &order_id = "asc",
+            fossil_algorithm_sort_cdf_fn cdf = nullptr,
+            void *context = nullptr
+            )
+            {
+            return fossil_algorithm_sort_flash(base, count, type_id.c_str(), order_id.c_str(), cdf, context);
+            }
+
+            /**
+             * @brief Stable partition by a built-in predicate.
+             *
+             * @param base Pointer to the array to partition in place.
+             * @param count Number of elements.
+             * @param type_id Fixed-width type identifier.
+             * @param predicate_id Predicate ("eq", "lt", "range", "mask", ...).
+             * @param lo Predicate operand, or bitmap for "mask".
+             * @param hi Upper bound for "range".
+             * @param matched Optional output for the number of matches.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int partition_if(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            const std::string &predicate_id,
+            const void *lo,
+            const void *hi = nullptr,
+            size_t *matched = nullptr
+            )
+            {
+            return fossil_algorithm_sort_partition_if(
+                base, count, type_id.c_str(), predicate_id.c_str(), lo, hi, matched);
+            }
+
+            /**
+             * @brief Compacts the elements that satisfy a predicate.
+             *
+             * @param base Pointer to the input array.
+             * @param out Destination array of at least @p count elements.
+             * @param count Number of elements.
+             * @param type_id Fixed-width type identifier.
+             * @param predicate_id Predicate ("eq", "lt", "range", "mask", ...).
+             * @param lo Predicate operand, or bitmap for "mask".
+             * @param hi Upper bound for "range".
+             * @param matched Optional output for the number of elements written.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int filter(
+            const void *base,
+            void *out,
+            size_t count,
+            const std::string &type_id,
+            const std::string &predicate_id,
+            const void *lo,
+            const void *hi = nullptr,
+            size_t *matched = nullptr
+            )
+            {
+            return fossil_algorithm_sort_filter(
+                base, out, count, type_id.c_str(), predicate_id.c_str(), lo, hi, matched);
+            }
+
+            /**
+             * @brief Scatters keys into 2^bits contiguous partitions.
+             *
+             * @param base Keys to partition.
+             * @param out Destination for the partitioned keys.
+             * @param count Number of keys.
+             * @param type_id Fixed-width key type identifier.
+             * @param method_id Partitioning method ("radix" or "hash").
+             * @param bits Number of partition bits.
+             * @param shift Low bit of the radix digit (ignored for "hash").
+             * @param offsets Output array of 2^bits + 1 partition offsets.
+             * @param threads Number of worker threads.
+             * @param payload Optional payload rows, or nullptr.
+             * @param payload_out Destination for payload rows.
+             * @param payload_size Size of one payload row in bytes.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int partition(
+            const void *base,
+            void *out,
+            size_t count,
+            const std::string &type_id,
+            const std::string &method_id,
+            unsigned bits,
+            unsigned shift,
+            size_t *offsets,
+            size_t threads = 1,
+            const void *payload = nullptr,
+            void *payload_out = nullptr,
+            size_t payload_size = 0
+            )
+            {
+            return fossil_algorithm_sort_partition(
+                base, out, count, type_id.c_str(), payload, payload_out, payload_size,
+                method_id.c_str(), bits, shift, offsets, threads);
+            }
+
+            /**
+             * @brief Removes adjacent duplicates from a sorted array in place.
+             *
+             * @param base Pointer to the sorted array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param unique_count Output for the number of elements kept.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int unique(void *base, size_t count, const std::string &type_id, size_t *unique_count)
+            {
+            return fossil_algorithm_sort_unique(base, count, type_id.c_str(), unique_count);
+            }
+
+            /**
+             * @brief Counts the distinct values of a sorted array.
+             *
+             * @param base Pointer to the sorted array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param unique_count Output for the number of distinct values.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int unique_count(const void *base, size_t count, const std::string &type_id, size_t *unique_count)
+            {
+            return fossil_algorithm_sort_unique_count(base, count, type_id.c_str(), unique_count);
+            }
+
+            /**
+             * @brief Sorts an array and removes duplicates.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param unique_count Output for the number of elements kept.
+             * @param algorithm_id Sorting algorithm identifier.
+             * @param order_id "asc" or "desc".
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int exec_unique(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            size_t *unique_count,
+            const std::string &algorithm_id = "auto",
+            const std::string &order_id = "asc"
+            )
+            {
+            return fossil_algorithm_sort_exec_unique(
+                base, count, type_id.c_str(), algorithm_id.c_str(), order_id.c_str(), unique_count);
+            }
+
+            /**
+             * @brief Run-length encodes an array.
+             *
+             * @param base Pointer to the input array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param values Optional output for one value per run.
+             * @param lengths Optional output for one length per run.
+             * @param run_count Output for the number of runs.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int rle_encode(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            void *values,
+            size_t *lengths,
+            size_t *run_count
+            )
+            {
+            return fossil_algorithm_sort_rle_encode(base, count, type_id.c_str(), values, lengths, run_count);
+            }
+
+            /**
+             * @brief Expands a run-length encoding back into an array.
+             *
+             * @param values Run values.
+             * @param lengths Run lengths.
+             * @param run_count Number of runs.
+             * @param type_id Type identifier.
+             * @param out Destination array, or nullptr to size only.
+             * @param capacity Number of elements @p out can hold.
+             * @param out_count Output for the decoded length.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int rle_decode(
+            const void *values,
+            const size_t *lengths,
+            size_t run_count,
+            const std::string &type_id,
+            void *out,
+            size_t capacity,
+            size_t *out_count
+            )
+            {
+            return fossil_algorithm_sort_rle_decode(
+                values, lengths, run_count, type_id.c_str(), out, capacity, out_count);
+            }
+
+            /**
+             * @brief Groups rows by key and aggregates their values.
+             *
+             * @param keys Key array.
+             * @param values Optional value array, or nullptr to only count.
+             * @param count Number of rows.
+             * @param key_type_id Fixed-width key type identifier.
+             * @param value_type_id Fixed-width numeric value type.
+             * @param out_keys Output for the distinct keys.
+             * @param out_groups Output for the aggregates.
+             * @param group_count Output for the number of groups.
+             * @param order_id "asc" or "desc".
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int group_by(
+            const void *keys,
+            const void *values,
+            size_t count,
+            const std::string &key_type_id,
+            const std::string &value_type_id,
+            void *out_keys,
+            fossil_algorithm_sort_group_t *out_groups,
+            size_t *group_count,
+            const std::string &order_id = "asc"
+            )
+            {
+            return fossil_algorithm_sort_group_by(
+                keys, values, count, key_type_id.c_str(), value_type_id.c_str(), order_id.c_str(),
+                out_keys, out_groups, group_count);
+            }
+
+            /**
+             * @brief Places several order statistics at their sorted positions.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Fixed-width type identifier.
+             * @param ranks Zero-based ranks to place.
+             * @param rank_count Number of ranks.
+             * @param order_id "asc" or "desc".
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int select(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            const size_t *ranks,
+            size_t rank_count,
+            const std::string &order_id = "asc"
+            )
+            {
+            return fossil_algorithm_sort_select(base, count, type_id.c_str(), ranks, rank_count, order_id.c_str());
+            }
+
+            /**
+             * @brief Exact quantiles by multi-selection.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Fixed-width type identifier.
+             * @param qs Quantiles, each in [0, 1].
+             * @param q_count Number of quantiles.
+             * @param out Output array of @p q_count elements.
+             * @param in_place Reorder @p base instead of a copy.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int quantiles(
+            void *base,
+            size_t count,
+            const std::string &type_id,
+            const double *qs,
+            size_t q_count,
+            void *out,
+            bool in_place = false
+            )
+            {
+            return fossil_algorithm_sort_quantiles(base, count, type_id.c_str(), qs, q_count, out, in_place);
+            }
+
+            /**
+             * @brief Exact (lower) median.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Fixed-width type identifier.
+             * @param out Output for one element.
+             * @param in_place Reorder @p base instead of a copy.
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int median(void *base, size_t count, const std::string &type_id, void *out, bool in_place = false)
+            {
+            return fossil_algorithm_sort_median(base, count, type_id.c_str(), out, in_place);
+            }
+
+            /**
+             * @brief Checks whether an array is sorted.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param order_id "asc" or "desc".
+             * @return bool True if sorted.
+             */
+            static bool is_sorted(const void *base, size_t count, const std::string &type_id, const std::string &order_id = "asc")
+            {
+            return fossil_algorithm_sort_is_sorted(base, count, type_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief Length of the longest sorted prefix.
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param order_id "asc" or "desc".
+             * @return size_t Index of the first element out of order, or @p count.
+             */
+            static size_t is_sorted_until(const void *base, size_t count, const std::string &type_id, const std::string &order_id = "asc")
+            {
+            return fossil_algorithm_sort_is_sorted_until(base, count, type_id.c_str(), order_id.c_str());
+            }
+
+            /**
+             * @brief Presortedness estimate (sorted prefix, runs, sampled inversions).
+             *
+             * @param base Pointer to the array.
+             * @param count Number of elements.
+             * @param type_id Type identifier.
+             * @param out Receives the measures.
+             * @param order_id "asc" or "desc".
+             * @return int Status code (0 on success, negative on error).
+             */
+            static int presortedness(
+            const void *base,
+            size_t count,
+            const std::string &type_id,
+            fossil_algorithm_sort_sortedness_t &out,
+            const std::string &order_id = "asc"
+            )
+            {
+            return fossil_algorithm_sort_presortedness(base, count, type_id.c_str(), order_id.c_str(), &out);
+            }
         };
 
     } // namespace bluecrab
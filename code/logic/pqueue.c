@@ -0,0 +1,490 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/algorithm/pqueue.h"
+#include "fossil/algorithm/sort.h"
+#include <string.h>
+#include <stdlib.h>
+
+// ======================================================
+// Local helpers
+// ======================================================
+
+typedef int (*fossil_pqueue_compare_fn)(const void *, const void *, bool desc);
+
+static inline int compare_i8(const void *a, const void *b, bool desc) {
+    int8_t va = *(const int8_t *)a;
+    int8_t vb = *(const int8_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_i16(const void *a, const void *b, bool desc) {
+    int16_t va = *(const int16_t *)a;
+    int16_t vb = *(const int16_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_i32(const void *a, const void *b, bool desc) {
+    int32_t va = *(const int32_t *)a;
+    int32_t vb = *(const int32_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_i64(const void *a, const void *b, bool desc) {
+    int64_t va = *(const int64_t *)a;
+    int64_t vb = *(const int64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_u8(const void *a, const void *b, bool desc) {
+    uint8_t va = *(const uint8_t *)a;
+    uint8_t vb = *(const uint8_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_u16(const void *a, const void *b, bool desc) {
+    uint16_t va = *(const uint16_t *)a;
+    uint16_t vb = *(const uint16_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_u32(const void *a, const void *b, bool desc) {
+    uint32_t va = *(const uint32_t *)a;
+    uint32_t vb = *(const uint32_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_u64(const void *a, const void *b, bool desc) {
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+// Hex, Oct, Bin: treat as unsigned integer for sorting
+static inline int compare_hex(const void *a, const void *b, bool desc) {
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_oct(const void *a, const void *b, bool desc) {
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_bin(const void *a, const void *b, bool desc) {
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_f32(const void *a, const void *b, bool desc) {
+    float va = *(const float *)a;
+    float vb = *(const float *)b;
+    if (va < vb) return desc ? 1 : -1;
+    if (va > vb) return desc ? -1 : 1;
+    return 0;
+}
+
+static inline int compare_f64(const void *a, const void *b, bool desc) {
+    double va = *(const double *)a;
+    double vb = *(const double *)b;
+    if (va < vb) return desc ? 1 : -1;
+    if (va > vb) return desc ? -1 : 1;
+    return 0;
+}
+
+static inline int compare_cstr(const void *a, const void *b, bool desc) {
+    const char *sa = *(const char * const *)a;
+    const char *sb = *(const char * const *)b;
+    int cmp = strcmp(sa ? sa : "", sb ? sb : "");
+    return desc ? -cmp : cmp;
+}
+
+static inline int compare_char(const void *a, const void *b, bool desc) {
+    char va = *(const char *)a;
+    char vb = *(const char *)b;
+    if (va == vb) return 0;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_bool(const void *a, const void *b, bool desc) {
+    bool va = *(const bool *)a;
+    bool vb = *(const bool *)b;
+    if (va == vb) return 0;
+    return desc ? (vb ? 1 : -1) : (va ? 1 : -1);
+}
+
+static inline int compare_size(const void *a, const void *b, bool desc) {
+    size_t va = *(const size_t *)a;
+    size_t vb = *(const size_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+// For datetime and duration, treat as int64_t for sorting
+static inline int compare_datetime(const void *a, const void *b, bool desc) {
+    int64_t va = *(const int64_t *)a;
+    int64_t vb = *(const int64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static inline int compare_duration(const void *a, const void *b, bool desc) {
+    int64_t va = *(const int64_t *)a;
+    int64_t vb = *(const int64_t *)b;
+    return desc ? (vb > va) - (vb < va) : (va > vb) - (va < vb);
+}
+
+static fossil_pqueue_compare_fn fossil_pqueue_select_comparator(const char *type_id) {
+    if (!strcmp(type_id, "i8"))       return compare_i8;
+    if (!strcmp(type_id, "i16"))      return compare_i16;
+    if (!strcmp(type_id, "i32"))      return compare_i32;
+    if (!strcmp(type_id, "i64"))      return compare_i64;
+
+    if (!strcmp(type_id, "u8"))       return compare_u8;
+    if (!strcmp(type_id, "u16"))      return compare_u16;
+    if (!strcmp(type_id, "u32"))      return compare_u32;
+    if (!strcmp(type_id, "u64"))      return compare_u64;
+
+    if (!strcmp(type_id, "hex"))      return compare_hex;
+    if (!strcmp(type_id, "oct"))      return compare_oct;
+    if (!strcmp(type_id, "bin"))      return compare_bin;
+
+    if (!strcmp(type_id, "f32"))      return compare_f32;
+    if (!strcmp(type_id, "f64"))      return compare_f64;
+
+    if (!strcmp(type_id, "bool"))     return compare_bool;
+    if (!strcmp(type_id, "char"))     return compare_char;
+    if (!strcmp(type_id, "cstr"))     return compare_cstr;
+
+    if (!strcmp(type_id, "size"))     return compare_size;
+
+    if (!strcmp(type_id, "datetime")) return compare_datetime;
+    if (!strcmp(type_id, "duration")) return compare_duration;
+
+    return NULL;
+}
+
+// ======================================================
+// Queue storage
+// ======================================================
+
+#define FOSSIL_PQUEUE_ARITY        4
+#define FOSSIL_PQUEUE_MIN_CAPACITY 16
+#define FOSSIL_PQUEUE_ELEM_MAX     16
+
+typedef union {
+    unsigned char bytes[FOSSIL_PQUEUE_ELEM_MAX];
+    uint64_t u64;
+    double f64;
+    void *ptr;
+} fossil_pqueue_elem_t;
+
+struct fossil_algorithm_pqueue {
+    unsigned char *data;      // elements in heap order
+    size_t *slot_of;          // heap index -> handle
+    size_t *index_of;         // handle -> heap index, NPOS when free
+    size_t *free_handles;     // recycled handles (stack)
+    size_t free_count;
+    size_t handle_count;      // handles ever issued
+    size_t size;
+    size_t capacity;
+    size_t type_size;
+    fossil_pqueue_compare_fn cmp;
+    bool desc;
+};
+
+static inline unsigned char *fossil_pqueue_at(const fossil_algorithm_pqueue_t *pq, size_t i)
+{
+    return pq->data + i * pq->type_size;
+}
+
+// True when a belongs nearer the top than b.
+static inline bool fossil_pqueue_before(const fossil_algorithm_pqueue_t *pq, const void *a, const void *b)
+{
+    return pq->cmp(a, b, pq->desc) < 0;
+}
+
+static inline void fossil_pqueue_place(fossil_algorithm_pqueue_t *pq, size_t i, const void *elem, size_t handle)
+{
+    memcpy(fossil_pqueue_at(pq, i), elem, pq->type_size);
+    pq->slot_of[i] = handle;
+    pq->index_of[handle] = i;
+}
+
+static int fossil_pqueue_reserve(fossil_algorithm_pqueue_t *pq, size_t needed)
+{
+    if (needed <= pq->capacity)
+        return 0;
+
+    size_t cap = pq->capacity ? pq->capacity : FOSSIL_PQUEUE_MIN_CAPACITY;
+    while (cap < needed) {
+        if (cap > ((size_t)-1) / 2 / pq->type_size) return -4;
+        cap *= 2;
+    }
+
+    unsigned char *data = realloc(pq->data, cap * pq->type_size);
+    if (!data) return -4;
+    pq->data = data;
+
+    size_t *slot_of = realloc(pq->slot_of, cap * sizeof(size_t));
+    if (!slot_of) return -4;
+    pq->slot_of = slot_of;
+
+    // A queue never holds more live handles than elements, so the handle
+    // tables grow with the element storage.
+    size_t *index_of = realloc(pq->index_of, cap * sizeof(size_t));
+    if (!index_of) return -4;
+    pq->index_of = index_of;
+
+    size_t *free_handles = realloc(pq->free_handles, cap * sizeof(size_t));
+    if (!free_handles) return -4;
+    pq->free_handles = free_handles;
+
+    pq->capacity = cap;
+    return 0;
+}
+
+static size_t fossil_pqueue_take_handle(fossil_algorithm_pqueue_t *pq)
+{
+    if (pq->free_count > 0)
+        return pq->free_handles[--pq->free_count];
+    return pq->handle_count++;
+}
+
+static void fossil_pqueue_release_handle(fossil_algorithm_pqueue_t *pq, size_t handle)
+{
+    pq->index_of[handle] = FOSSIL_ALGORITHM_PQUEUE_NPOS;
+    pq->free_handles[pq->free_count++] = handle;
+}
+
+// Moves the element (elem, handle) up from the hole at i.
+static void fossil_pqueue_sift_up(fossil_algorithm_pqueue_t *pq, size_t i, const void *elem, size_t handle)
+{
+    while (i > 0) {
+        size_t parent = (i - 1) / FOSSIL_PQUEUE_ARITY;
+        if (!fossil_pqueue_before(pq, elem, fossil_pqueue_at(pq, parent)))
+            break;
+        fossil_pqueue_place(pq, i, fossil_pqueue_at(pq, parent), pq->slot_of[parent]);
+        i = parent;
+    }
+    fossil_pqueue_place(pq, i, elem, handle);
+}
+
+// Bottom-up sift: walks the hole at i down to a leaf, then sifts elem up.
+static void fossil_pqueue_sift_down(fossil_algorithm_pqueue_t *pq, size_t i, const void *elem, size_t handle)
+{
+    size_t top = i;
+    size_t child;
+    while ((child = FOSSIL_PQUEUE_ARITY * i + 1) < pq->size) {
+        size_t best = child;
+        size_t last = (pq->size - child > FOSSIL_PQUEUE_ARITY) ? child + FOSSIL_PQUEUE_ARITY : pq->size;
+        for (size_t c = child + 1; c < last; ++c)
+            if (fossil_pqueue_before(pq, fossil_pqueue_at(pq, c), fossil_pqueue_at(pq, best)))
+                best = c;
+        fossil_pqueue_place(pq, i, fossil_pqueue_at(pq, best), pq->slot_of[best]);
+        i = best;
+    }
+    while (i > top) {
+        size_t parent = (i - 1) / FOSSIL_PQUEUE_ARITY;
+        if (!fossil_pqueue_before(pq, elem, fossil_pqueue_at(pq, parent)))
+            break;
+        fossil_pqueue_place(pq, i, fossil_pqueue_at(pq, parent), pq->slot_of[parent]);
+        i = parent;
+    }
+    fossil_pqueue_place(pq, i, elem, handle);
+}
+
+// ======================================================
+// Public API
+// ======================================================
+
+fossil_algorithm_pqueue_t *fossil_algorithm_pqueue_create(
+    const char *type_id,
+    const char *order_id,
+    size_t capacity)
+{
+    if (!type_id)
+        return NULL;
+
+    size_t type_size = fossil_algorithm_sort_type_sizeof(type_id);
+    fossil_pqueue_compare_fn cmp = fossil_pqueue_select_comparator(type_id);
+    if (type_size == 0 || type_size > FOSSIL_PQUEUE_ELEM_MAX || !cmp)
+        return NULL;
+
+    fossil_algorithm_pqueue_t *pq = calloc(1, sizeof(*pq));
+    if (!pq)
+        return NULL;
+
+    pq->type_size = type_size;
+    pq->cmp = cmp;
+    pq->desc = (order_id && strcmp(order_id, "desc") == 0);
+
+    if (fossil_pqueue_reserve(pq, capacity) != 0) {
+        fossil_algorithm_pqueue_destroy(pq);
+        return NULL;
+    }
+    return pq;
+}
+
+void fossil_algorithm_pqueue_destroy(fossil_algorithm_pqueue_t *pq)
+{
+    if (!pq)
+        return;
+    free(pq->data);
+    free(pq->slot_of);
+    free(pq->index_of);
+    free(pq->free_handles);
+    free(pq);
+}
+
+int fossil_algorithm_pqueue_push(fossil_algorithm_pqueue_t *pq, const void *elem, size_t *handle)
+{
+    if (!pq || !elem)
+        return -1;
+    if (fossil_pqueue_reserve(pq, pq->size + 1) != 0)
+        return -4;
+
+    // Copy first: elem may point into the queue's own storage.
+    fossil_pqueue_elem_t tmp;
+    memcpy(tmp.bytes, elem, pq->type_size);
+
+    size_t h = fossil_pqueue_take_handle(pq);
+    fossil_pqueue_sift_up(pq, pq->size++, tmp.bytes, h);
+
+    if (handle) *handle = h;
+    return 0;
+}
+
+int fossil_algorithm_pqueue_pop(fossil_algorithm_pqueue_t *pq, void *out, size_t *handle)
+{
+    if (!pq)
+        return -1;
+    if (pq->size == 0)
+        return -2;
+
+    size_t h = pq->slot_of[0];
+    if (out) memcpy(out, fossil_pqueue_at(pq, 0), pq->type_size);
+    if (handle) *handle = h;
+    fossil_pqueue_release_handle(pq, h);
+
+    size_t last = --pq->size;
+    if (last > 0) {
+        fossil_pqueue_elem_t tmp;
+        memcpy(tmp.bytes, fossil_pqueue_at(pq, last), pq->type_size);
+        fossil_pqueue_sift_down(pq, 0, tmp.bytes, pq->slot_of[last]);
+    }
+    return 0;
+}
+
+int fossil_algorithm_pqueue_top(const fossil_algorithm_pqueue_t *pq, void *out, size_t *handle)
+{
+    if (!pq)
+        return -1;
+    if (pq->size == 0)
+        return -2;
+
+    if (out) memcpy(out, fossil_pqueue_at(pq, 0), pq->type_size);
+    if (handle) *handle = pq->slot_of[0];
+    return 0;
+}
+
+int fossil_algorithm_pqueue_replace_top(fossil_algorithm_pqueue_t *pq, const void *elem, void *out)
+{
+    if (!pq || !elem)
+        return -1;
+    if (pq->size == 0)
+        return -2;
+
+    fossil_pqueue_elem_t tmp;
+    memcpy(tmp.bytes, elem, pq->type_size);
+    if (out) memcpy(out, fossil_pqueue_at(pq, 0), pq->type_size);
+
+    fossil_pqueue_sift_down(pq, 0, tmp.bytes, pq->slot_of[0]);
+    return 0;
+}
+
+int fossil_algorithm_pqueue_heapify(
+    fossil_algorithm_pqueue_t *pq,
+    const void *elems,
+    size_t count,
+    size_t *handles)
+{
+    if (!pq || (!elems && count > 0))
+        return -1;
+    if (count == 0)
+        return 0;
+    if (fossil_pqueue_reserve(pq, pq->size + count) != 0)
+        return -4;
+
+    const unsigned char *src = (const unsigned char *)elems;
+    for (size_t i = 0; i < count; ++i) {
+        size_t h = fossil_pqueue_take_handle(pq);
+        fossil_pqueue_place(pq, pq->size + i, src + i * pq->type_size, h);
+        if (handles) handles[i] = h;
+    }
+    pq->size += count;
+
+    // Floyd's bottom-up construction over the whole array.
+    fossil_pqueue_elem_t tmp;
+    if (pq->size > 1) {
+        for (size_t i = (pq->size - 2) / FOSSIL_PQUEUE_ARITY + 1; i-- > 0;) {
+            memcpy(tmp.bytes, fossil_pqueue_at(pq, i), pq->type_size);
+            fossil_pqueue_sift_down(pq, i, tmp.bytes, pq->slot_of[i]);
+        }
+    }
+    return 0;
+}
+
+int fossil_algorithm_pqueue_update_key(fossil_algorithm_pqueue_t *pq, size_t handle, const void *elem)
+{
+    if (!pq || !elem)
+        return -1;
+    if (handle >= pq->handle_count || pq->index_of[handle] == FOSSIL_ALGORITHM_PQUEUE_NPOS)
+        return -3;
+
+    fossil_pqueue_elem_t tmp;
+    memcpy(tmp.bytes, elem, pq->type_size);
+
+    size_t i = pq->index_of[handle];
+    if (i > 0 && fossil_pqueue_before(pq, tmp.bytes, fossil_pqueue_at(pq, (i - 1) / FOSSIL_PQUEUE_ARITY)))
+        fossil_pqueue_sift_up(pq, i, tmp.bytes, handle);
+    else
+        fossil_pqueue_sift_down(pq, i, tmp.bytes, handle);
+    return 0;
+}
+
+size_t fossil_algorithm_pqueue_size(const fossil_algorithm_pqueue_t *pq)
+{
+    return pq ? pq->size : 0;
+}
+
+void fossil_algorithm_pqueue_clear(fossil_algorithm_pqueue_t *pq)
+{
+    if (!pq)
+        return;
+    pq->size = 0;
+    pq->free_count = 0;
+    pq->handle_count = 0;
+}
@@ -23,10 +23,13 @@
  * -----------------------------------------------------------------------------
  */
 #include "fossil/algorithm/search.h"
+#include "fossil/algorithm/sort.h"
 #include <string.h>
+#include <stdlib.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include "thread.h"
 
 // ======================================================
 // Search API Supported Identifiers
@@ -62,9 +65,10 @@
  * | "interpolation" | Interpolation search (sorted, uniform)|
  * | "exponential"   | Exponential search (sorted arrays)   |
  * | "fibonacci"     | Fibonacci search (sorted arrays)     |
+ * | "parallel"      | Multithreaded linear search          |
  */
 #define FOSSIL_SEARCH_SUPPORTED_ALGO_IDS \
-    "auto, linear, binary, jump, interpolation, exponential, fibonacci"
+    "auto, linear, binary, jump, interpolation, exponential, fibonacci, parallel"
 
 /**
  * @brief Supported order identifiers for @ref fossil_algorithm_sort_exec.
@@ -313,138 +317,32 @@ static int search_jump(
     return -1;
 }
 
-static int search_interpolation(
-    const void *base, size_t count, const void *key,
+// First index in [lo, count) whose element is not ordered before key, found
+// by doubling steps from lo and a binary search over the last step. Cost is
+// logarithmic in the distance travelled, not in count.
+static size_t search_gallop(
+    const void *base, size_t lo, size_t count, const void *key,
     size_t size, fossil_search_compare_fn cmp, bool desc)
 {
-    // Only works for uniformly distributed sorted numeric arrays
-    if (count == 0 || !base || !key) return -2;
+    const unsigned char *ptr = (const unsigned char *)base;
+    size_t step = 1, hi = lo;
 
-    size_t low = 0, high = count - 1;
+    while (hi < count && cmp(ptr + hi * size, key, desc) < 0) {
+        lo = hi + 1;
+        hi += step;
+        step *= 2;
+    }
+    if (hi > count)
+        hi = count;
 
-    if (size == sizeof(int32_t)) {
-        const int32_t *arr = (const int32_t *)base;
-        int32_t k = *(const int32_t *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
-    } else if (size == sizeof(int64_t)) {
-        const int64_t *arr = (const int64_t *)base;
-        int64_t k = *(const int64_t *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
-    } else if (size == sizeof(uint32_t)) {
-        const uint32_t *arr = (const uint32_t *)base;
-        uint32_t k = *(const uint32_t *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
-    } else if (size == sizeof(uint64_t)) {
-        const uint64_t *arr = (const uint64_t *)base;
-        uint64_t k = *(const uint64_t *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
-    } else if (size == sizeof(float)) {
-        const float *arr = (const float *)base;
-        float k = *(const float *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
-    } else if (size == sizeof(double)) {
-        const double *arr = (const double *)base;
-        double k = *(const double *)key;
-        while (low <= high &&
-               ((desc && k <= arr[low] && k >= arr[high]) ||
-                (!desc && k >= arr[low] && k <= arr[high]))) {
-            if (arr[high] == arr[low]) {
-                if (cmp(&arr[low], &k, desc) == 0) return (int)low;
-                break;
-            }
-            size_t pos = low + (size_t)(((double)(high - low) * (k - arr[low])) / (arr[high] - arr[low]));
-            if (pos < low || pos > high) break;
-            if (cmp(&arr[pos], &k, desc) == 0)
-                return (int)pos;
-            if ((desc && arr[pos] < k) || (!desc && arr[pos] > k))
-                high = pos - 1;
-            else
-                low = pos + 1;
-        }
-        return -1;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (cmp(ptr + mid * size, key, desc) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    // Not supported for other types
-    return -4;
+    return lo;
 }
 
 static int search_exponential(
@@ -452,28 +350,10 @@ static int search_exponential(
     size_t size, fossil_search_compare_fn cmp, bool desc)
 {
     if (count == 0 || !base || !key || !cmp) return -1;
-    size_t bound = 1;
-    const unsigned char *ptr = (const unsigned char *)base;
-
-    // Find range where key may be present
-    while (bound < count && cmp(ptr + bound * size, key, desc) < 0)
-        bound *= 2;
 
-    size_t low = bound / 2;
-    size_t high = bound < count ? bound : count;
-
-    // Binary search in found range
-    while (low < high) {
-        size_t mid = low + (high - low) / 2;
-        const void *mid_elem = ptr + mid * size;
-        int c = cmp(mid_elem, key, desc);
-        if (c == 0)
-            return (int)mid;
-        if (c < 0)
-            low = mid + 1;
-        else
-            high = mid;
-    }
+    size_t i = search_gallop(base, 0, count, key, size, cmp, desc);
+    if (i < count && cmp((const unsigned char *)base + i * size, key, desc) == 0)
+        return (int)i;
     return -1;
 }
 
@@ -519,50 +399,2550 @@ static int search_fibonacci(
 }
 
 // ======================================================
-// Dispatcher
+// Small-input fast path
 // ======================================================
 
-int fossil_algorithm_search_exec(
-    const void *base,
-    size_t count,
-    const void *key,
+/**
+ * @brief Linear searches up to this many elements use the typed scan.
+ */
+#define FOSSIL_SEARCH_SMALL_MAX 64
+
+/**
+ * @brief Equality classes for the typed scan.
+ *
+ * Integer-like types only need bit equality, so they collapse to their
+ * width. Floats keep comparator semantics (0.0 == -0.0, NaN matches as in
+ * compare_f32/compare_f64).
+ */
+typedef enum {
+    FOSSIL_SEARCH_KIND_NONE = 0,
+    FOSSIL_SEARCH_KIND_W8,
+    FOSSIL_SEARCH_KIND_W16,
+    FOSSIL_SEARCH_KIND_W32,
+    FOSSIL_SEARCH_KIND_W64,
+    FOSSIL_SEARCH_KIND_F32,
+    FOSSIL_SEARCH_KIND_F64
+} fossil_search_kind_t;
+
+static fossil_search_kind_t fossil_search_select_kind(const char *type_id)
+{
+    switch (type_id[0]) {
+    case 'i':
+    case 'u':
+        if (!strcmp(type_id + 1, "8"))  return FOSSIL_SEARCH_KIND_W8;
+        if (!strcmp(type_id + 1, "16")) return FOSSIL_SEARCH_KIND_W16;
+        if (!strcmp(type_id + 1, "32")) return FOSSIL_SEARCH_KIND_W32;
+        if (!strcmp(type_id + 1, "64")) return FOSSIL_SEARCH_KIND_W64;
+        break;
+    case 'f':
+        if (!strcmp(type_id, "f32"))    return FOSSIL_SEARCH_KIND_F32;
+        if (!strcmp(type_id, "f64"))    return FOSSIL_SEARCH_KIND_F64;
+        break;
+    case 'c':
+        if (!strcmp(type_id, "char"))   return FOSSIL_SEARCH_KIND_W8;
+        break;
+    case 'b':
+        if (!strcmp(type_id, "bool"))   return sizeof(bool) == 1 ? FOSSIL_SEARCH_KIND_W8 : FOSSIL_SEARCH_KIND_NONE;
+        break;
+    case 's':
+        if (!strcmp(type_id, "size"))   return sizeof(size_t) == 8 ? FOSSIL_SEARCH_KIND_W64 : FOSSIL_SEARCH_KIND_W32;
+        break;
+    default:
+        break;
+    }
+    return FOSSIL_SEARCH_KIND_NONE;
+}
+
+#define FOSSIL_SEARCH_EQ_INT(x, k)   ((x) == (k))
+#define FOSSIL_SEARCH_EQ_FLOAT(x, k) (!((x) < (k)) & !((x) > (k)))
+
+// Four-wide unrolled scan: the combined test compiles to one vector compare
+// or a short run of flag-setting compares, and only a hit leaves the loop.
+#define FOSSIL_SEARCH_DEFINE_SCAN(SUFFIX, T, EQ) \
+    static int fossil_search_scan_##SUFFIX(const T *a, size_t n, T k) \
+    { \
+        size_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            if (EQ(a[i], k) | EQ(a[i + 1], k) | EQ(a[i + 2], k) | EQ(a[i + 3], k)) { \
+                while (!EQ(a[i], k)) ++i; \
+                return (int)i; \
+            } \
+        } \
+        for (; i < n; ++i) \
+            if (EQ(a[i], k)) return (int)i; \
+        return -1; \
+    }
+
+FOSSIL_SEARCH_DEFINE_SCAN(w8,  uint8_t,  FOSSIL_SEARCH_EQ_INT)
+FOSSIL_SEARCH_DEFINE_SCAN(w16, uint16_t, FOSSIL_SEARCH_EQ_INT)
+FOSSIL_SEARCH_DEFINE_SCAN(w32, uint32_t, FOSSIL_SEARCH_EQ_INT)
+FOSSIL_SEARCH_DEFINE_SCAN(w64, uint64_t, FOSSIL_SEARCH_EQ_INT)
+FOSSIL_SEARCH_DEFINE_SCAN(f32, float,    FOSSIL_SEARCH_EQ_FLOAT)
+FOSSIL_SEARCH_DEFINE_SCAN(f64, double,   FOSSIL_SEARCH_EQ_FLOAT)
+
+static int fossil_search_scan_kind(const void *base, size_t count, const void *key, fossil_search_kind_t kind)
+{
+    switch (kind) {
+    case FOSSIL_SEARCH_KIND_W8:  return fossil_search_scan_w8((const uint8_t *)base, count, *(const uint8_t *)key);
+    case FOSSIL_SEARCH_KIND_W16: return fossil_search_scan_w16((const uint16_t *)base, count, *(const uint16_t *)key);
+    case FOSSIL_SEARCH_KIND_W32: return fossil_search_scan_w32((const uint32_t *)base, count, *(const uint32_t *)key);
+    case FOSSIL_SEARCH_KIND_W64: return fossil_search_scan_w64((const uint64_t *)base, count, *(const uint64_t *)key);
+    case FOSSIL_SEARCH_KIND_F32: return fossil_search_scan_f32((const float *)base, count, *(const float *)key);
+    case FOSSIL_SEARCH_KIND_F64: return fossil_search_scan_f64((const double *)base, count, *(const double *)key);
+    default:                     return -2;
+    }
+}
+
+// ======================================================
+// Sorted-set operations
+// ======================================================
+
+// Ordered kinds for the typed set kernels: every type_id with a comparator
+// and a fixed-width native representation.
+#define FOSSIL_SEARCH_FOREACH_ORDERED(X) \
+    X(I8,   i8,   int8_t)   \
+    X(I16,  i16,  int16_t)  \
+    X(I32,  i32,  int32_t)  \
+    X(I64,  i64,  int64_t)  \
+    X(U8,   u8,   uint8_t)  \
+    X(U16,  u16,  uint16_t) \
+    X(U32,  u32,  uint32_t) \
+    X(U64,  u64,  uint64_t) \
+    X(F32,  f32,  float)    \
+    X(F64,  f64,  double)   \
+    X(CHAR, char, char)
+
+typedef enum {
+    FOSSIL_SEARCH_ORDERED_NONE = 0,
+#define FOSSIL_SEARCH_ORDERED_ENUM(NAME, SUFFIX, T) FOSSIL_SEARCH_ORDERED_##NAME,
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_ORDERED_ENUM)
+#undef FOSSIL_SEARCH_ORDERED_ENUM
+    FOSSIL_SEARCH_ORDERED_END
+} fossil_search_ordered_t;
+
+static fossil_search_ordered_t fossil_search_select_ordered(const char *type_id)
+{
+    if (!strcmp(type_id, "i8"))   return FOSSIL_SEARCH_ORDERED_I8;
+    if (!strcmp(type_id, "i16"))  return FOSSIL_SEARCH_ORDERED_I16;
+    if (!strcmp(type_id, "i32"))  return FOSSIL_SEARCH_ORDERED_I32;
+    if (!strcmp(type_id, "i64"))  return FOSSIL_SEARCH_ORDERED_I64;
+    if (!strcmp(type_id, "u8"))   return FOSSIL_SEARCH_ORDERED_U8;
+    if (!strcmp(type_id, "u16"))  return FOSSIL_SEARCH_ORDERED_U16;
+    if (!strcmp(type_id, "u32"))  return FOSSIL_SEARCH_ORDERED_U32;
+    if (!strcmp(type_id, "u64"))  return FOSSIL_SEARCH_ORDERED_U64;
+    if (!strcmp(type_id, "f32"))  return FOSSIL_SEARCH_ORDERED_F32;
+    if (!strcmp(type_id, "f64"))  return FOSSIL_SEARCH_ORDERED_F64;
+    if (!strcmp(type_id, "char")) return FOSSIL_SEARCH_ORDERED_CHAR;
+    if (!strcmp(type_id, "bool"))
+        return sizeof(bool) == 1 ? FOSSIL_SEARCH_ORDERED_U8 : FOSSIL_SEARCH_ORDERED_NONE;
+    if (!strcmp(type_id, "size"))
+        return sizeof(size_t) == 8 ? FOSSIL_SEARCH_ORDERED_U64 : FOSSIL_SEARCH_ORDERED_U32;
+    return FOSSIL_SEARCH_ORDERED_NONE;
+}
+
+typedef enum {
+    FOSSIL_SET_INTERSECT,
+    FOSSIL_SET_UNION,
+    FOSSIL_SET_DIFFERENCE
+} fossil_set_op_t;
+
+// Above this size ratio the smaller side gallops through the larger one
+// instead of merging element by element.
+#define FOSSIL_SET_GALLOP_RATIO 32
+
+#define FOSSIL_SEARCH_BEFORE(x, y) (desc ? (x) > (y) : (x) < (y))
+
+// Typed kernels. With out == NULL they only count. Multiset semantics match
+// the usual merge definitions: a value present m times in a and n times in b
+// appears min(m, n), max(m, n) and max(m - n, 0) times respectively.
+#define FOSSIL_SEARCH_DEFINE_SET(NAME, SUFFIX, T) \
+    static size_t fossil_set_gallop_##SUFFIX(const T *b, size_t lo, size_t n, T key, bool desc) \
+    { \
+        size_t step = 1, hi = lo; \
+        while (hi < n && FOSSIL_SEARCH_BEFORE(b[hi], key)) { \
+            lo = hi + 1; \
+            hi += step; \
+            step *= 2; \
+        } \
+        if (hi > n) \
+            hi = n; \
+        while (lo < hi) { \
+            size_t mid = lo + (hi - lo) / 2; \
+            if (FOSSIL_SEARCH_BEFORE(b[mid], key)) \
+                lo = mid + 1; \
+            else \
+                hi = mid; \
+        } \
+        return lo; \
+    } \
+    /* Branch-free merge intersection for inputs of similar size. */ \
+    static size_t fossil_set_intersect_merge_##SUFFIX( \
+        const T *a, size_t na, const T *b, size_t nb, T *out, bool desc) \
+    { \
+        size_t i = 0, j = 0, k = 0; \
+        T sink; \
+        T *dst = out ? out : &sink; \
+        size_t stride = out ? 1 : 0; \
+        while (i < na && j < nb) { \
+            T x = a[i], y = b[j]; \
+            size_t lt = (size_t)FOSSIL_SEARCH_BEFORE(x, y); \
+            size_t gt = (size_t)FOSSIL_SEARCH_BEFORE(y, x); \
+            dst[k * stride] = x; \
+            k += (lt | gt) ^ 1u; \
+            i += gt ^ 1u; \
+            j += lt ^ 1u; \
+        } \
+        return k; \
+    } \
+    static size_t fossil_set_intersect_gallop_##SUFFIX( \
+        const T *a, size_t na, const T *b, size_t nb, T *out, bool desc) \
+    { \
+        size_t j = 0, k = 0; \
+        for (size_t i = 0; i < na && j < nb; ++i) { \
+            j = fossil_set_gallop_##SUFFIX(b, j, nb, a[i], desc); \
+            if (j < nb && !FOSSIL_SEARCH_BEFORE(a[i], b[j])) { \
+                if (out) \
+                    out[k] = a[i]; \
+                ++k; \
+                ++j; \
+            } \
+        } \
+        return k; \
+    } \
+    /* Copies b[from, to) to out + k (if out) and returns the new k. */ \
+    static size_t fossil_set_emit_##SUFFIX(T *out, size_t k, const T *b, size_t from, size_t to) \
+    { \
+        if (out && to > from) \
+            memcpy(out + k, b + from, (to - from) * sizeof(T)); \
+        return k + (to - from); \
+    } \
+    static size_t fossil_set_union_##SUFFIX( \
+        const T *a, size_t na, const T *b, size_t nb, T *out, bool desc) \
+    { \
+        if (na > nb) { \
+            const T *t = a; a = b; b = t; \
+            size_t tn = na; na = nb; nb = tn; \
+        } \
+        size_t j = 0, k = 0; \
+        bool gallop = na * FOSSIL_SET_GALLOP_RATIO < nb; \
+        for (size_t i = 0; i < na; ++i) { \
+            T x = a[i]; \
+            size_t p = gallop ? fossil_set_gallop_##SUFFIX(b, j, nb, x, desc) : j; \
+            if (!gallop) \
+                while (p < nb && FOSSIL_SEARCH_BEFORE(b[p], x)) \
+                    ++p; \
+            k = fossil_set_emit_##SUFFIX(out, k, b, j, p); \
+            j = p; \
+            if (j < nb && !FOSSIL_SEARCH_BEFORE(x, b[j])) \
+                ++j; \
+            if (out) \
+                out[k] = x; \
+            ++k; \
+        } \
+        return fossil_set_emit_##SUFFIX(out, k, b, j, nb); \
+    } \
+    static size_t fossil_set_difference_##SUFFIX( \
+        const T *a, size_t na, const T *b, size_t nb, T *out, bool desc) \
+    { \
+        bool gallop = na * FOSSIL_SET_GALLOP_RATIO < nb; \
+        size_t j = 0, k = 0; \
+        for (size_t i = 0; i < na; ++i) { \
+            T x = a[i]; \
+            if (gallop) { \
+                j = fossil_set_gallop_##SUFFIX(b, j, nb, x, desc); \
+            } else { \
+                while (j < nb && FOSSIL_SEARCH_BEFORE(b[j], x)) \
+                    ++j; \
+            } \
+            if (j < nb && !FOSSIL_SEARCH_BEFORE(x, b[j])) { \
+                ++j; \
+                continue; \
+            } \
+            if (out) \
+                out[k] = x; \
+            ++k; \
+        } \
+        return k; \
+    } \
+    static size_t fossil_set_run_##SUFFIX( \
+        const void *va, size_t na, const void *vb, size_t nb, void *vout, fossil_set_op_t op, bool desc) \
+    { \
+        const T *a = (const T *)va, *b = (const T *)vb; \
+        T *out = (T *)vout; \
+        switch (op) { \
+        case FOSSIL_SET_INTERSECT: \
+            if (na > nb) { \
+                const T *t = a; a = b; b = t; \
+                size_t tn = na; na = nb; nb = tn; \
+            } \
+            if (na * FOSSIL_SET_GALLOP_RATIO < nb) \
+                return fossil_set_intersect_gallop_##SUFFIX(a, na, b, nb, out, desc); \
+            return fossil_set_intersect_merge_##SUFFIX(a, na, b, nb, out, desc); \
+        case FOSSIL_SET_UNION: \
+            return fossil_set_union_##SUFFIX(a, na, b, nb, out, desc); \
+        default: \
+            return fossil_set_difference_##SUFFIX(a, na, b, nb, out, desc); \
+        } \
+    }
+
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_SET)
+
+// Comparator-driven fallback for "cstr" and any other non-native type.
+static size_t fossil_set_run_generic(
+    const void *va, size_t na, const void *vb, size_t nb, void *vout,
+    size_t size, fossil_search_compare_fn cmp, fossil_set_op_t op, bool desc)
+{
+    const unsigned char *a = (const unsigned char *)va, *b = (const unsigned char *)vb;
+    unsigned char *out = (unsigned char *)vout;
+    size_t i = 0, j = 0, k = 0;
+
+    if (op == FOSSIL_SET_INTERSECT && na * FOSSIL_SET_GALLOP_RATIO < nb) {
+        for (; i < na && j < nb; ++i) {
+            j = search_gallop(b, j, nb, a + i * size, size, cmp, desc);
+            if (j < nb && cmp(a + i * size, b + j * size, desc) == 0) {
+                if (out)
+                    memcpy(out + k * size, a + i * size, size);
+                ++k;
+                ++j;
+            }
+        }
+        return k;
+    }
+
+    while (i < na && j < nb) {
+        int c = cmp(a + i * size, b + j * size, desc);
+        const unsigned char *emit = NULL;
+        if (c < 0) {
+            if (op != FOSSIL_SET_INTERSECT)
+                emit = a + i * size;
+            ++i;
+        } else if (c > 0) {
+            if (op == FOSSIL_SET_UNION)
+                emit = b + j * size;
+            ++j;
+        } else {
+            if (op != FOSSIL_SET_DIFFERENCE)
+                emit = a + i * size;
+            ++i;
+            ++j;
+        }
+        if (emit) {
+            if (out)
+                memcpy(out + k * size, emit, size);
+            ++k;
+        }
+    }
+    if (op != FOSSIL_SET_INTERSECT) {
+        if (out)
+            memcpy(out + k * size, a + i * size, (na - i) * size);
+        k += na - i;
+    }
+    if (op == FOSSIL_SET_UNION) {
+        if (out)
+            memcpy(out + k * size, b + j * size, (nb - j) * size);
+        k += nb - j;
+    }
+    return k;
+}
+
+int fossil_algorithm_search_set(
+    const void *a,
+    size_t a_count,
+    const void *b,
+    size_t b_count,
+    void *out,
+    size_t *out_count,
     const char *type_id,
-    const char *algorithm_id,
+    const char *op_id,
     const char *order_id)
 {
-    if (!base || !key || count == 0 || !type_id)
+    if ((a_count && !a) || (b_count && !b) || !out_count || !type_id || !op_id)
         return -2; // invalid input
 
     size_t type_size = fossil_algorithm_search_type_sizeof(type_id);
-    if (type_size == 0)
+    fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
+    if (type_size == 0 || !cmp)
         return -3; // unknown type
 
+    fossil_set_op_t op;
+    if (!strcmp(op_id, "intersect"))
+        op = FOSSIL_SET_INTERSECT;
+    else if (!strcmp(op_id, "union"))
+        op = FOSSIL_SET_UNION;
+    else if (!strcmp(op_id, "difference"))
+        op = FOSSIL_SET_DIFFERENCE;
+    else
+        return -4; // unknown operation
+
     bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    switch (fossil_search_select_ordered(type_id)) {
+#define FOSSIL_SEARCH_CASE_SET(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: \
+        *out_count = fossil_set_run_##SUFFIX(a, a_count, b, b_count, out, op, desc); \
+        return 0;
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_SET)
+#undef FOSSIL_SEARCH_CASE_SET
+    default:
+        break;
+    }
+
+    *out_count = fossil_set_run_generic(a, a_count, b, b_count, out, type_size, cmp, op, desc);
+    return 0;
+}
+
+int fossil_algorithm_search_intersect_many(
+    const void *const *lists,
+    const size_t *counts,
+    size_t list_count,
+    void *out,
+    size_t *out_count,
+    const char *type_id,
+    const char *order_id)
+{
+    if (!lists || !counts || list_count == 0 || !out_count || !type_id)
+        return -2; // invalid input
+    for (size_t l = 0; l < list_count; ++l)
+        if (counts[l] && !lists[l])
+            return -2;
+
+    size_t type_size = fossil_algorithm_search_type_sizeof(type_id);
     fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
-    if (!cmp)
+    if (type_size == 0 || !cmp)
         return -3; // unknown type
 
-    if (!algorithm_id || !strcmp(algorithm_id, "auto") || !strcmp(algorithm_id, "linear"))
-        return search_linear(base, count, key, type_size, cmp, desc);
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
 
-    if (!strcmp(algorithm_id, "binary"))
-        return search_binary(base, count, key, type_size, cmp, desc);
+    // Drive from the shortest list and gallop through the others, longest
+    // last, so most candidates are rejected by the cheapest probes.
+    size_t *order = malloc(2 * list_count * sizeof(size_t));
+    if (!order)
+        return -5; // out of memory
+    size_t *cursor = order + list_count;
+    for (size_t l = 0; l < list_count; ++l) {
+        size_t v = l, p = l;
+        while (p > 0 && counts[order[p - 1]] > counts[v]) {
+            order[p] = order[p - 1];
+            --p;
+        }
+        order[p] = v;
+        cursor[l] = 0;
+    }
 
-    if (!strcmp(algorithm_id, "jump"))
-        return search_jump(base, count, key, type_size, cmp, desc);
+    const unsigned char *lead = (const unsigned char *)lists[order[0]];
+    unsigned char *dst = (unsigned char *)out;
+    size_t k = 0;
+    for (size_t i = 0; i < counts[order[0]]; ++i) {
+        const void *x = lead + i * type_size;
+        bool all = true, exhausted = false;
+        for (size_t l = 1; l < list_count && all; ++l) {
+            size_t id = order[l];
+            size_t j = search_gallop(lists[id], cursor[l], counts[id], x, type_size, cmp, desc);
+            cursor[l] = j;
+            if (j == counts[id])
+                exhausted = true;
+            all = !exhausted && cmp((const unsigned char *)lists[id] + j * type_size, x, desc) == 0;
+        }
+        if (all) {
+            for (size_t l = 1; l < list_count; ++l)
+                cursor[l]++;
+            if (dst)
+                memcpy(dst + k * type_size, x, type_size);
+            ++k;
+        }
+        if (exhausted)
+            break;
+    }
 
-    if (!strcmp(algorithm_id, "interpolation")) {
-        // Only support int32_t and int64_t for interpolation
-        if (!(type_size == sizeof(int32_t) || type_size == sizeof(int64_t)))
-            return -4;
-        return search_interpolation(base, count, key, type_size, cmp, desc);
+    free(order);
+    *out_count = k;
+    return 0;
+}
+
+// ======================================================
+// Finger search
+// ======================================================
+
+// Lower bound of key galloping outward from a hint: forward when the element
+// at the hint is ordered before key, backward otherwise, then a binary
+// search over the last doubling step. O(log d) for a distance d from the
+// hint, so a monotone query stream costs nearly constant time per key. With
+// upper set it finds the upper bound (first element ordered after key).
+#define FOSSIL_FINGER_PRED(x) (upper ? !FOSSIL_SEARCH_BEFORE(key, x) : FOSSIL_SEARCH_BEFORE(x, key))
+
+#define FOSSIL_SEARCH_DEFINE_FINGER(NAME, SUFFIX, T) \
+    static size_t fossil_finger_##SUFFIX(const T *a, size_t n, size_t hint, T key, bool desc, bool upper) \
+    { \
+        size_t lo, hi, step = 1; \
+        if (hint > n) \
+            hint = n; \
+        if (hint < n && FOSSIL_FINGER_PRED(a[hint])) { \
+            lo = hint + 1; \
+            hi = lo; \
+            while (hi < n && FOSSIL_FINGER_PRED(a[hi])) { \
+                lo = hi + 1; \
+                hi += step; \
+                step *= 2; \
+            } \
+            if (hi > n) \
+                hi = n; \
+        } else { \
+            hi = hint; \
+            lo = 0; \
+            while (hi > 0) { \
+                size_t probe = hi > step ? hi - step : 0; \
+                if (FOSSIL_FINGER_PRED(a[probe])) { \
+                    lo = probe + 1; \
+                    break; \
+                } \
+                hi = probe; \
+                step *= 2; \
+            } \
+        } \
+        while (lo < hi) { \
+            size_t mid = lo + (hi - lo) / 2; \
+            if (FOSSIL_FINGER_PRED(a[mid])) \
+                lo = mid + 1; \
+            else \
+                hi = mid; \
+        } \
+        return lo; \
     }
 
-    if (!strcmp(algorithm_id, "exponential"))
-        return search_exponential(base, count, key, type_size, cmp, desc);
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_FINGER)
 
-    if (!strcmp(algorithm_id, "fibonacci"))
-        return search_fibonacci(base, count, key, type_size, cmp, desc);
+static size_t fossil_finger_generic(
+    const void *base, size_t n, size_t hint, const void *key, size_t size, fossil_search_compare_fn cmp, bool desc)
+{
+    const unsigned char *ptr = (const unsigned char *)base;
+    if (hint > n)
+        hint = n;
+    if (hint < n && cmp(ptr + hint * size, key, desc) < 0)
+        return search_gallop(base, hint + 1, n, key, size, cmp, desc);
+
+    size_t lo = 0, hi = hint, step = 1;
+    while (hi > 0) {
+        size_t probe = hi > step ? hi - step : 0;
+        if (cmp(ptr + probe * size, key, desc) < 0) {
+            lo = probe + 1;
+            break;
+        }
+        hi = probe;
+        step *= 2;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (cmp(ptr + mid * size, key, desc) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
 
-    return -4; // unknown algorithm
+struct fossil_algorithm_search_cursor {
+    const void *base;
+    size_t count;
+    size_t type_size;
+    fossil_search_compare_fn cmp;
+    fossil_search_ordered_t ordered;
+    bool desc;
+    size_t pos;
+};
+
+// Moves the cursor to the lower bound of key and reports an exact match.
+static int fossil_finger_find(fossil_algorithm_search_cursor_t *c, const void *key)
+{
+    size_t i;
+    bool desc = c->desc;
+    switch (c->ordered) {
+#define FOSSIL_SEARCH_CASE_FINGER(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: { \
+        const T *a = (const T *)c->base; \
+        T k; \
+        memcpy(&k, key, sizeof(T)); \
+        i = fossil_finger_##SUFFIX(a, c->count, c->pos, k, desc, false); \
+        c->pos = i; \
+        return (i < c->count && !FOSSIL_SEARCH_BEFORE(k, a[i])) ? (int)i : -1; \
+    }
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_FINGER)
+#undef FOSSIL_SEARCH_CASE_FINGER
+    default:
+        break;
+    }
+    i = fossil_finger_generic(c->base, c->count, c->pos, key, c->type_size, c->cmp, desc);
+    c->pos = i;
+    if (i < c->count && c->cmp((const unsigned char *)c->base + i * c->type_size, key, desc) == 0)
+        return (int)i;
+    return -1;
+}
+
+static int fossil_finger_init(
+    fossil_algorithm_search_cursor_t *c, const void *base, size_t count, const char *type_id, const char *order_id)
+{
+    c->type_size = fossil_algorithm_search_type_sizeof(type_id);
+    c->cmp = fossil_search_select_comparator(type_id);
+    if (c->type_size == 0 || !c->cmp)
+        return -3; // unknown type
+    c->base = base;
+    c->count = count;
+    c->ordered = fossil_search_select_ordered(type_id);
+    c->desc = (order_id && strcmp(order_id, "desc") == 0);
+    c->pos = 0;
+    return 0;
+}
+
+int fossil_algorithm_search_finger(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *order_id,
+    size_t *hint)
+{
+    if (!base || !key || count == 0 || !type_id || !hint)
+        return -2; // invalid input
+
+    fossil_algorithm_search_cursor_t c;
+    int status = fossil_finger_init(&c, base, count, type_id, order_id);
+    if (status != 0)
+        return status;
+    c.pos = *hint;
+    status = fossil_finger_find(&c, key);
+    *hint = c.pos;
+    return status;
+}
+
+fossil_algorithm_search_cursor_t *fossil_algorithm_search_cursor_create(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id)
+{
+    if ((!base && count > 0) || !type_id)
+        return NULL;
+
+    fossil_algorithm_search_cursor_t *c = malloc(sizeof(*c));
+    if (!c)
+        return NULL;
+    if (fossil_finger_init(c, base, count, type_id, order_id) != 0) {
+        free(c);
+        return NULL;
+    }
+    return c;
+}
+
+void fossil_algorithm_search_cursor_destroy(fossil_algorithm_search_cursor_t *cursor)
+{
+    free(cursor);
+}
+
+int fossil_algorithm_search_cursor_find(fossil_algorithm_search_cursor_t *cursor, const void *key)
+{
+    if (!cursor || !key)
+        return -2; // invalid input
+    if (cursor->count == 0)
+        return -1;
+    return fossil_finger_find(cursor, key);
+}
+
+size_t fossil_algorithm_search_cursor_position(const fossil_algorithm_search_cursor_t *cursor)
+{
+    return cursor ? cursor->pos : 0;
+}
+
+void fossil_algorithm_search_cursor_seek(fossil_algorithm_search_cursor_t *cursor, size_t position)
+{
+    if (cursor)
+        cursor->pos = position < cursor->count ? position : cursor->count;
+}
+
+// ======================================================
+// Nearest-value search
+// ======================================================
+
+typedef enum {
+    FOSSIL_NEAREST_FLOOR,
+    FOSSIL_NEAREST_CEILING,
+    FOSSIL_NEAREST_NEAREST,
+    FOSSIL_NEAREST_WITHIN
+} fossil_nearest_mode_t;
+
+// Numeric layouts for the nearest-value search. Timestamps and durations
+// are i64 and the radix types u64 here, even though exact search does not
+// accept them; "char" and "bool" have no meaningful distance.
+static fossil_search_ordered_t fossil_nearest_select_kind(const char *type_id)
+{
+    if (!strcmp(type_id, "datetime") || !strcmp(type_id, "duration"))
+        return FOSSIL_SEARCH_ORDERED_I64;
+    if (!strcmp(type_id, "hex") || !strcmp(type_id, "oct") || !strcmp(type_id, "bin"))
+        return FOSSIL_SEARCH_ORDERED_U64;
+    if (!strcmp(type_id, "char") || !strcmp(type_id, "bool"))
+        return FOSSIL_SEARCH_ORDERED_NONE;
+    return fossil_search_select_ordered(type_id);
+}
+
+static int fossil_nearest_select_mode(const char *mode_id, fossil_nearest_mode_t *mode)
+{
+    if (!mode_id || !strcmp(mode_id, "nearest"))
+        *mode = FOSSIL_NEAREST_NEAREST;
+    else if (!strcmp(mode_id, "floor"))
+        *mode = FOSSIL_NEAREST_FLOOR;
+    else if (!strcmp(mode_id, "ceiling") || !strcmp(mode_id, "ceil"))
+        *mode = FOSSIL_NEAREST_CEILING;
+    else if (!strcmp(mode_id, "within"))
+        *mode = FOSSIL_NEAREST_WITHIN;
+    else
+        return -4; // unknown mode
+    return 0;
+}
+
+#define FOSSIL_NEAREST_IS_FLOAT(T) ((T)0.5 != (T)0)
+
+// Per-kind kernels:
+//  - udist: |x - key| for integer kinds, exact in uint64_t over the full
+//    range of every width.
+//  - dist: |x - key| as double, for the "within" epsilon test.
+//  - closer: whether x is strictly nearer to key than y; integers compare
+//    their exact distances, since doubles tie above 2^53.
+//  - pick: chooses between the floor and ceiling candidates by mode.
+//  - bound: branch-free lower (upper) bound for one sorted lookup.
+//  - scan: floor and ceiling candidates of unsorted data in one pass,
+//    keeping the first index of each value.
+#define FOSSIL_SEARCH_DEFINE_NEAREST(NAME, SUFFIX, T) \
+    static uint64_t fossil_nearest_udist_##SUFFIX(T x, T key) \
+    { \
+        return x >= key ? (uint64_t)x - (uint64_t)key : (uint64_t)key - (uint64_t)x; \
+    } \
+    \
+    static double fossil_nearest_dist_##SUFFIX(T x, T key) \
+    { \
+        if (FOSSIL_NEAREST_IS_FLOAT(T)) \
+            return fabs((double)x - (double)key); \
+        return (double)fossil_nearest_udist_##SUFFIX(x, key); \
+    } \
+    \
+    static bool fossil_nearest_closer_##SUFFIX(T x, T y, T key) \
+    { \
+        if (FOSSIL_NEAREST_IS_FLOAT(T)) \
+            return fossil_nearest_dist_##SUFFIX(x, key) < fossil_nearest_dist_##SUFFIX(y, key); \
+        return fossil_nearest_udist_##SUFFIX(x, key) < fossil_nearest_udist_##SUFFIX(y, key); \
+    } \
+    \
+    static int fossil_nearest_pick_##SUFFIX( \
+        const T *a, T key, size_t f, size_t c, size_t n, fossil_nearest_mode_t mode, double epsilon) \
+    { \
+        size_t i; \
+        if (mode == FOSSIL_NEAREST_FLOOR) \
+            i = f; \
+        else if (mode == FOSSIL_NEAREST_CEILING) \
+            i = c; \
+        else if (f == n || c == n) \
+            i = f == n ? c : f; \
+        else \
+            i = fossil_nearest_closer_##SUFFIX(a[c], a[f], key) ? c : f; \
+        if (i == n) \
+            return -1; \
+        if (mode == FOSSIL_NEAREST_WITHIN && !(fossil_nearest_dist_##SUFFIX(a[i], key) <= epsilon)) \
+            return -1; \
+        return (int)i; \
+    } \
+    \
+    static size_t fossil_nearest_bound_##SUFFIX(const T *a, size_t n, T key, bool desc, bool upper) \
+    { \
+        const T *p = a; \
+        if (n == 0) \
+            return 0; \
+        while (n > 1) { \
+            size_t half = n / 2; \
+            p += FOSSIL_FINGER_PRED(p[half - 1]) ? half : 0; \
+            n -= half; \
+        } \
+        return (size_t)(p - a) + FOSSIL_FINGER_PRED(*p); \
+    } \
+    \
+    static void fossil_nearest_scan_##SUFFIX(const T *a, size_t n, T key, size_t *floor_at, size_t *ceil_at) \
+    { \
+        size_t f = n, c = n; \
+        T fv = key, cv = key; \
+        for (size_t i = 0; i < n; ++i) { \
+            T x = a[i]; \
+            bool tf = x <= key && (f == n || x > fv); \
+            bool tc = x >= key && (c == n || x < cv); \
+            f = tf ? i : f; \
+            fv = tf ? x : fv; \
+            c = tc ? i : c; \
+            cv = tc ? x : cv; \
+        } \
+        *floor_at = f; \
+        *ceil_at = c; \
+    } \
+    \
+    static void fossil_nearest_many_##SUFFIX( \
+        const T *a, size_t n, const T *keys, size_t m, fossil_nearest_mode_t mode, int sorted, bool desc, \
+        double epsilon, int *out) \
+    { \
+        size_t lo = 0, hi = 0; \
+        for (size_t q = 0; q < m; ++q) { \
+            T key = keys[q]; \
+            size_t f, c; \
+            if (FOSSIL_NEAREST_IS_FLOAT(T) && isnan((double)key)) { \
+                out[q] = -1; \
+                continue; \
+            } \
+            if (!sorted) { \
+                fossil_nearest_scan_##SUFFIX(a, n, key, &f, &c); \
+            } else { \
+                lo = m > 1 ? fossil_finger_##SUFFIX(a, n, lo, key, desc, false) \
+                           : fossil_nearest_bound_##SUFFIX(a, n, key, desc, false); \
+                hi = m > 1 ? fossil_finger_##SUFFIX(a, n, hi > lo ? hi : lo, key, desc, true) \
+                           : fossil_nearest_bound_##SUFFIX(a, n, key, desc, true); \
+                f = desc ? lo : (hi > 0 ? hi - 1 : n); \
+                c = desc ? (hi > 0 ? hi - 1 : n) : lo; \
+            } \
+            out[q] = fossil_nearest_pick_##SUFFIX(a, key, f, c, n, mode, epsilon); \
+        } \
+    }
+
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_NEAREST)
+
+int fossil_algorithm_search_nearest_many(
+    const void *base,
+    size_t count,
+    const void *keys,
+    size_t key_count,
+    const char *type_id,
+    const char *mode_id,
+    const char *order_id,
+    double epsilon,
+    int *out)
+{
+    if (!base || count == 0 || !keys || !type_id || !out)
+        return -2; // invalid input
+
+    fossil_search_ordered_t kind = fossil_nearest_select_kind(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        return -3; // unknown or non-numeric type
+
+    fossil_nearest_mode_t mode;
+    if (fossil_nearest_select_mode(mode_id, &mode) != 0)
+        return -4; // unknown mode
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    int sorted = !(order_id && strcmp(order_id, "unsorted") == 0);
+
+    switch (kind) {
+#define FOSSIL_SEARCH_CASE_NEAREST(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: \
+        fossil_nearest_many_##SUFFIX( \
+            (const T *)base, count, (const T *)keys, key_count, mode, sorted, desc, epsilon, out); \
+        return 0;
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_NEAREST)
+#undef FOSSIL_SEARCH_CASE_NEAREST
+    default:
+        return -3;
+    }
+}
+
+int fossil_algorithm_search_nearest(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *mode_id,
+    const char *order_id,
+    double epsilon)
+{
+    int idx = -1;
+    int status = fossil_algorithm_search_nearest_many(
+        base, count, key, 1, type_id, mode_id, order_id, epsilon, &idx);
+    return status != 0 ? status : idx;
+}
+
+// ======================================================
+// Min / max reductions
+// ======================================================
+
+/**
+ * @brief Fewest elements per thread before "threads" is scaled down.
+ */
+#define FOSSIL_SEARCH_THREAD_MIN_CHUNK ((size_t)1 << 16)
+
+// One chunk of a reduction. Values are kept as raw bytes so one job layout
+// serves every kind.
+typedef struct {
+    const void *base;
+    size_t n;
+    fossil_search_ordered_t kind;
+    bool found;
+    unsigned char lo[sizeof(uint64_t)];
+    unsigned char hi[sizeof(uint64_t)];
+} fossil_extrema_job_t;
+
+// Extreme values first, indices second: the value pass keeps four
+// independent min/max lanes with select-only updates, which compilers turn
+// into vector min/max, and the index pass stops at the first match. NaN
+// compares false everywhere and is never chosen.
+#define FOSSIL_SEARCH_DEFINE_EXTREMA(NAME, SUFFIX, T) \
+    static bool fossil_extrema_##SUFFIX(const T *a, size_t n, T *lo_out, T *hi_out) \
+    { \
+        size_t i = 0; \
+        while (i < n && FOSSIL_NEAREST_IS_FLOAT(T) && isnan((double)a[i])) \
+            ++i; \
+        if (i == n) \
+            return false; \
+        T lo0 = a[i], lo1 = lo0, lo2 = lo0, lo3 = lo0; \
+        T hi0 = lo0, hi1 = lo0, hi2 = lo0, hi3 = lo0; \
+        for (; i + 4 <= n; i += 4) { \
+            lo0 = a[i] < lo0 ? a[i] : lo0; \
+            lo1 = a[i + 1] < lo1 ? a[i + 1] : lo1; \
+            lo2 = a[i + 2] < lo2 ? a[i + 2] : lo2; \
+            lo3 = a[i + 3] < lo3 ? a[i + 3] : lo3; \
+            hi0 = a[i] > hi0 ? a[i] : hi0; \
+            hi1 = a[i + 1] > hi1 ? a[i + 1] : hi1; \
+            hi2 = a[i + 2] > hi2 ? a[i + 2] : hi2; \
+            hi3 = a[i + 3] > hi3 ? a[i + 3] : hi3; \
+        } \
+        for (; i < n; ++i) { \
+            lo0 = a[i] < lo0 ? a[i] : lo0; \
+            hi0 = a[i] > hi0 ? a[i] : hi0; \
+        } \
+        lo0 = lo1 < lo0 ? lo1 : lo0; \
+        lo2 = lo3 < lo2 ? lo3 : lo2; \
+        hi0 = hi1 > hi0 ? hi1 : hi0; \
+        hi2 = hi3 > hi2 ? hi3 : hi2; \
+        *lo_out = lo2 < lo0 ? lo2 : lo0; \
+        *hi_out = hi2 > hi0 ? hi2 : hi0; \
+        return true; \
+    } \
+    \
+    static void fossil_extrema_job_##SUFFIX(void *arg) \
+    { \
+        fossil_extrema_job_t *job = (fossil_extrema_job_t *)arg; \
+        T lo = 0, hi = 0; \
+        job->found = fossil_extrema_##SUFFIX((const T *)job->base, job->n, &lo, &hi); \
+        memcpy(job->lo, &lo, sizeof(T)); \
+        memcpy(job->hi, &hi, sizeof(T)); \
+    } \
+    \
+    static size_t fossil_find_first_##SUFFIX(const T *a, size_t n, T v) \
+    { \
+        size_t i = 0; \
+        while (i < n && !(a[i] == v)) \
+            ++i; \
+        return i; \
+    } \
+    \
+    static bool fossil_minmax_##SUFFIX( \
+        fossil_extrema_job_t *jobs, size_t job_count, size_t chunk, size_t *imin, size_t *imax) \
+    { \
+        size_t jlo = job_count, jhi = job_count; \
+        T lo = 0, hi = 0; \
+        for (size_t j = 0; j < job_count; ++j) { \
+            if (!jobs[j].found) \
+                continue; \
+            T l, h; \
+            memcpy(&l, jobs[j].lo, sizeof(T)); \
+            memcpy(&h, jobs[j].hi, sizeof(T)); \
+            if (jlo == job_count || l < lo) { \
+                lo = l; \
+                jlo = j; \
+            } \
+            if (jhi == job_count || h > hi) { \
+                hi = h; \
+                jhi = j; \
+            } \
+        } \
+        if (jlo == job_count) \
+            return false; \
+        if (imin) \
+            *imin = jlo * chunk + fossil_find_first_##SUFFIX((const T *)jobs[jlo].base, jobs[jlo].n, lo); \
+        if (imax) \
+            *imax = jhi * chunk + fossil_find_first_##SUFFIX((const T *)jobs[jhi].base, jobs[jhi].n, hi); \
+        return true; \
+    }
+
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_EXTREMA)
+
+static void fossil_extrema_job(void *arg)
+{
+    switch (((fossil_extrema_job_t *)arg)->kind) {
+#define FOSSIL_SEARCH_CASE_EXTREMA_JOB(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: fossil_extrema_job_##SUFFIX(arg); return;
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_EXTREMA_JOB)
+#undef FOSSIL_SEARCH_CASE_EXTREMA_JOB
+    default:
+        return;
+    }
+}
+
+// Comparator fallback for "cstr": one pass, first index of each extreme.
+static void fossil_minmax_generic(
+    const void *base, size_t count, size_t size, fossil_search_compare_fn cmp, size_t *imin, size_t *imax)
+{
+    const unsigned char *ptr = (const unsigned char *)base;
+    size_t lo = 0, hi = 0;
+    for (size_t i = 1; i < count; ++i) {
+        if (cmp(ptr + i * size, ptr + lo * size, false) < 0)
+            lo = i;
+        if (cmp(ptr + i * size, ptr + hi * size, false) > 0)
+            hi = i;
+    }
+    if (imin)
+        *imin = lo;
+    if (imax)
+        *imax = hi;
+}
+
+int fossil_algorithm_search_minmax(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    size_t *min_index,
+    size_t *max_index,
+    size_t threads)
+{
+    if (!base || count == 0 || !type_id)
+        return -2; // invalid input
+
+    fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        kind = fossil_nearest_select_kind(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE) {
+        size_t size = fossil_algorithm_search_type_sizeof(type_id);
+        fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
+        if (size == 0 || !cmp)
+            return -3; // unknown type
+        fossil_minmax_generic(base, count, size, cmp, min_index, max_index);
+        return 0;
+    }
+
+    if (threads > FOSSIL_ALGORITHM_MAX_THREADS)
+        threads = FOSSIL_ALGORITHM_MAX_THREADS;
+    if (threads > count / FOSSIL_SEARCH_THREAD_MIN_CHUNK)
+        threads = count / FOSSIL_SEARCH_THREAD_MIN_CHUNK;
+    if (threads == 0)
+        threads = 1;
+
+    size_t size = fossil_algorithm_search_type_sizeof(type_id);
+    if (size == 0)
+        size = sizeof(uint64_t); // datetime, duration: i64 layout
+    size_t chunk = (count + threads - 1) / threads;
+    fossil_extrema_job_t jobs[FOSSIL_ALGORITHM_MAX_THREADS];
+    size_t job_count = 0;
+    for (size_t start = 0; start < count; start += chunk) {
+        fossil_extrema_job_t *job = &jobs[job_count++];
+        job->base = (const unsigned char *)base + start * size;
+        job->n = count - start < chunk ? count - start : chunk;
+        job->kind = kind;
+        job->found = false;
+    }
+    fossil_algorithm_run_parallel(fossil_extrema_job, jobs, sizeof(jobs[0]), job_count);
+
+    bool found = false;
+    switch (kind) {
+#define FOSSIL_SEARCH_CASE_MINMAX(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: \
+        found = fossil_minmax_##SUFFIX(jobs, job_count, chunk, min_index, max_index); \
+        break;
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_MINMAX)
+#undef FOSSIL_SEARCH_CASE_MINMAX
+    default:
+        break;
+    }
+    return found ? 0 : -1; // -1: only NaN
+}
+
+int fossil_algorithm_search_argmin(const void *base, size_t count, const char *type_id)
+{
+    size_t i = 0;
+    int status = fossil_algorithm_search_minmax(base, count, type_id, &i, NULL, 1);
+    return status != 0 ? status : (int)i;
+}
+
+int fossil_algorithm_search_argmax(const void *base, size_t count, const char *type_id)
+{
+    size_t i = 0;
+    int status = fossil_algorithm_search_minmax(base, count, type_id, NULL, &i, 1);
+    return status != 0 ? status : (int)i;
+}
+
+// Copies the element at the index found by the reduction.
+static int fossil_extreme_value(const void *base, size_t count, const char *type_id, void *out, bool max)
+{
+    if (!out)
+        return -2; // invalid input
+    size_t i = 0;
+    int status = fossil_algorithm_search_minmax(base, count, type_id, max ? NULL : &i, max ? &i : NULL, 1);
+    if (status != 0)
+        return status;
+    size_t size = fossil_algorithm_search_type_sizeof(type_id);
+    if (size == 0)
+        size = sizeof(uint64_t);
+    memcpy(out, (const unsigned char *)base + i * size, size);
+    return 0;
+}
+
+int fossil_algorithm_search_min(const void *base, size_t count, const char *type_id, void *out)
+{
+    return fossil_extreme_value(base, count, type_id, out, false);
+}
+
+int fossil_algorithm_search_max(const void *base, size_t count, const char *type_id, void *out)
+{
+    return fossil_extreme_value(base, count, type_id, out, true);
+}
+
+// ======================================================
+// Filter scans
+// ======================================================
+
+typedef enum {
+    FOSSIL_SCAN_EQ,
+    FOSSIL_SCAN_NE,
+    FOSSIL_SCAN_LT,
+    FOSSIL_SCAN_LE,
+    FOSSIL_SCAN_GT,
+    FOSSIL_SCAN_GE,
+    FOSSIL_SCAN_RANGE
+} fossil_scan_pred_t;
+
+static int fossil_scan_select_pred(const char *predicate_id, fossil_scan_pred_t *pred)
+{
+    static const struct { const char *id; fossil_scan_pred_t pred; } preds[] = {
+        { "eq", FOSSIL_SCAN_EQ }, { "ne", FOSSIL_SCAN_NE },
+        { "lt", FOSSIL_SCAN_LT }, { "le", FOSSIL_SCAN_LE },
+        { "gt", FOSSIL_SCAN_GT }, { "ge", FOSSIL_SCAN_GE },
+        { "range", FOSSIL_SCAN_RANGE }
+    };
+    if (!predicate_id)
+        return -4;
+    for (size_t i = 0; i < sizeof(preds) / sizeof(preds[0]); ++i) {
+        if (!strcmp(predicate_id, preds[i].id)) {
+            *pred = preds[i].pred;
+            return 0;
+        }
+    }
+    return -4; // unknown predicate
+}
+
+// One chunk of a scan. Selection vectors are written from idx + start and
+// compacted by the caller; bitmap chunks start on a byte boundary.
+typedef struct {
+    const void *base;
+    size_t n;
+    size_t start;
+    fossil_search_ordered_t kind;
+    fossil_scan_pred_t pred;
+    unsigned char lo[sizeof(uint64_t)];
+    unsigned char hi[sizeof(uint64_t)];
+    size_t *idx;
+    unsigned char *bits;
+    size_t matched;
+} fossil_scan_job_t;
+
+// Loop bodies shared by every predicate. The selection vector store is
+// branch-free (write the index, advance on a match), the bitmap packs eight
+// results per byte and the count only sums them, so each loop is free of
+// data-dependent branches and open to the vectoriser.
+#define FOSSIL_SCAN_BODY(PRED) \
+    do { \
+        if (idx) { \
+            for (size_t i = 0; i < n; ++i) { \
+                idx[k] = start + i; \
+                k += PRED(a[i]); \
+            } \
+        } else if (bits) { \
+            size_t i = 0; \
+            for (; i + 8 <= n; i += 8) { \
+                unsigned m = 0; \
+                for (unsigned j = 0; j < 8; ++j) { \
+                    unsigned b = PRED(a[i + j]); \
+                    m |= b << j; \
+                    k += b; \
+                } \
+                bits[i / 8] = (unsigned char)m; \
+            } \
+            if (i < n) { \
+                unsigned m = 0; \
+                for (unsigned j = 0; i + j < n; ++j) { \
+                    unsigned b = PRED(a[i + j]); \
+                    m |= b << j; \
+                    k += b; \
+                } \
+                bits[i / 8] = (unsigned char)m; \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; ++i) \
+                k += PRED(a[i]); \
+        } \
+    } while (0)
+
+#define FOSSIL_SCAN_EQ_P(x)    ((x) == lo)
+#define FOSSIL_SCAN_NE_P(x)    ((x) != lo)
+#define FOSSIL_SCAN_LT_P(x)    ((x) < lo)
+#define FOSSIL_SCAN_LE_P(x)    ((x) <= lo)
+#define FOSSIL_SCAN_GT_P(x)    ((x) > lo)
+#define FOSSIL_SCAN_GE_P(x)    ((x) >= lo)
+#define FOSSIL_SCAN_RANGE_P(x) (((x) >= lo) & ((x) <= hi))
+
+#define FOSSIL_SEARCH_DEFINE_FILTER(NAME, SUFFIX, T) \
+    static void fossil_filter_##SUFFIX(fossil_scan_job_t *job) \
+    { \
+        const T *a = (const T *)job->base; \
+        size_t n = job->n, start = job->start, k = 0; \
+        size_t *idx = job->idx ? job->idx + start : NULL; \
+        unsigned char *bits = job->bits ? job->bits + start / 8 : NULL; \
+        T lo, hi; \
+        memcpy(&lo, job->lo, sizeof(T)); \
+        memcpy(&hi, job->hi, sizeof(T)); \
+        switch (job->pred) { \
+        case FOSSIL_SCAN_EQ:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_EQ_P); break; \
+        case FOSSIL_SCAN_NE:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_NE_P); break; \
+        case FOSSIL_SCAN_LT:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_LT_P); break; \
+        case FOSSIL_SCAN_LE:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_LE_P); break; \
+        case FOSSIL_SCAN_GT:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_GT_P); break; \
+        case FOSSIL_SCAN_GE:    FOSSIL_SCAN_BODY(FOSSIL_SCAN_GE_P); break; \
+        case FOSSIL_SCAN_RANGE: FOSSIL_SCAN_BODY(FOSSIL_SCAN_RANGE_P); break; \
+        } \
+        job->matched = k; \
+    }
+
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_FILTER)
+
+static void fossil_scan_job(void *arg)
+{
+    fossil_scan_job_t *job = (fossil_scan_job_t *)arg;
+    switch (job->kind) {
+#define FOSSIL_SEARCH_CASE_SCAN(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: fossil_filter_##SUFFIX(job); return;
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_SCAN)
+#undef FOSSIL_SEARCH_CASE_SCAN
+    default:
+        return;
+    }
+}
+
+static int fossil_scan_run(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *indices,
+    unsigned char *bitmap,
+    size_t *match_count,
+    size_t threads)
+{
+    if (!base || !type_id || !lo || !match_count)
+        return -2; // invalid input
+
+    fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        kind = fossil_nearest_select_kind(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        return -3; // unknown or non fixed-width type
+
+    fossil_scan_pred_t pred;
+    if (fossil_scan_select_pred(predicate_id, &pred) != 0)
+        return -4; // unknown predicate
+    if (pred == FOSSIL_SCAN_RANGE && !hi)
+        return -2;
+
+    size_t size = fossil_algorithm_search_type_sizeof(type_id);
+    if (size == 0)
+        size = sizeof(uint64_t); // datetime, duration: i64 layout
+
+    *match_count = 0;
+    if (count == 0)
+        return 0;
+
+    if (threads > FOSSIL_ALGORITHM_MAX_THREADS)
+        threads = FOSSIL_ALGORITHM_MAX_THREADS;
+    if (threads > count / FOSSIL_SEARCH_THREAD_MIN_CHUNK)
+        threads = count / FOSSIL_SEARCH_THREAD_MIN_CHUNK;
+    if (threads == 0)
+        threads = 1;
+
+    // Chunks are multiples of 64 elements so bitmap chunks never share a byte.
+    size_t chunk = (count + threads - 1) / threads;
+    chunk = (chunk + 63) & ~(size_t)63;
+    fossil_scan_job_t jobs[FOSSIL_ALGORITHM_MAX_THREADS];
+    size_t job_count = 0;
+    for (size_t start = 0; start < count; start += chunk) {
+        fossil_scan_job_t *job = &jobs[job_count++];
+        job->base = (const unsigned char *)base + start * size;
+        job->n = count - start < chunk ? count - start : chunk;
+        job->start = start;
+        job->kind = kind;
+        job->pred = pred;
+        memcpy(job->lo, lo, size);
+        memcpy(job->hi, hi ? hi : lo, size);
+        job->idx = indices;
+        job->bits = bitmap;
+        job->matched = 0;
+    }
+    fossil_algorithm_run_parallel(fossil_scan_job, jobs, sizeof(jobs[0]), job_count);
+
+    size_t total = 0;
+    for (size_t j = 0; j < job_count; ++j) {
+        if (indices && total != jobs[j].start)
+            memmove(indices + total, indices + jobs[j].start, jobs[j].matched * sizeof(size_t));
+        total += jobs[j].matched;
+    }
+    *match_count = total;
+    return 0;
+}
+
+int fossil_algorithm_search_find_all(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *indices,
+    size_t *match_count,
+    size_t threads)
+{
+    if (!indices)
+        return -2; // invalid input
+    return fossil_scan_run(base, count, type_id, predicate_id, lo, hi, indices, NULL, match_count, threads);
+}
+
+int fossil_algorithm_search_match_bitmap(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    unsigned char *bitmap,
+    size_t *match_count,
+    size_t threads)
+{
+    if (!bitmap)
+        return -2; // invalid input
+    return fossil_scan_run(base, count, type_id, predicate_id, lo, hi, NULL, bitmap, match_count, threads);
+}
+
+int fossil_algorithm_search_count_matches(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *match_count,
+    size_t threads)
+{
+    return fossil_scan_run(base, count, type_id, predicate_id, lo, hi, NULL, NULL, match_count, threads);
+}
+
+// ======================================================
+// Strided search
+// ======================================================
+
+typedef enum {
+    FOSSIL_STRIDED_LINEAR,
+    FOSSIL_STRIDED_BINARY,
+    FOSSIL_STRIDED_INTERPOLATION
+} fossil_strided_algo_t;
+
+/**
+ * @brief Interpolation probes before the search falls back to bisection.
+ *
+ * Keeps skewed key distributions at O(log n) instead of O(n).
+ */
+#define FOSSIL_STRIDED_MAX_PROBES 32
+
+#define FOSSIL_STRIDED_AT(T, i) (*(const T *)(p + (i) * stride))
+
+// Per-kind kernels over records of stride bytes, p pointing at the field of
+// the first record. Dense arrays are the case stride == sizeof(T).
+//  - linear: four records per step, one combined test, like the typed scan.
+//  - binary: branch-free lower bound, so the first equal record is found.
+//  - interpolation: integer kinds only; position estimates in double, each
+//    probe clamped to the live range.
+#define FOSSIL_SEARCH_DEFINE_STRIDED(NAME, SUFFIX, T) \
+    static int fossil_strided_linear_##SUFFIX(const unsigned char *p, size_t n, size_t stride, T k) \
+    { \
+        size_t i = 0; \
+        for (; i + 4 <= n; i += 4) { \
+            T x0 = FOSSIL_STRIDED_AT(T, i), x1 = FOSSIL_STRIDED_AT(T, i + 1); \
+            T x2 = FOSSIL_STRIDED_AT(T, i + 2), x3 = FOSSIL_STRIDED_AT(T, i + 3); \
+            if (FOSSIL_SEARCH_EQ_FLOAT(x0, k) | FOSSIL_SEARCH_EQ_FLOAT(x1, k) | \
+                FOSSIL_SEARCH_EQ_FLOAT(x2, k) | FOSSIL_SEARCH_EQ_FLOAT(x3, k)) { \
+                while (!FOSSIL_SEARCH_EQ_FLOAT(FOSSIL_STRIDED_AT(T, i), k)) ++i; \
+                return (int)i; \
+            } \
+        } \
+        for (; i < n; ++i) \
+            if (FOSSIL_SEARCH_EQ_FLOAT(FOSSIL_STRIDED_AT(T, i), k)) return (int)i; \
+        return -1; \
+    } \
+    \
+    static size_t fossil_strided_bound_##SUFFIX(const unsigned char *p, size_t lo, size_t n, size_t stride, T k, bool desc) \
+    { \
+        while (n > 1) { \
+            size_t half = n / 2; \
+            lo += FOSSIL_SEARCH_BEFORE(FOSSIL_STRIDED_AT(T, lo + half - 1), k) ? half : 0; \
+            n -= half; \
+        } \
+        return lo + (n == 1 && FOSSIL_SEARCH_BEFORE(FOSSIL_STRIDED_AT(T, lo), k)); \
+    } \
+    \
+    static int fossil_strided_binary_##SUFFIX(const unsigned char *p, size_t n, size_t stride, T k, bool desc) \
+    { \
+        size_t i = fossil_strided_bound_##SUFFIX(p, 0, n, stride, k, desc); \
+        return i < n && FOSSIL_SEARCH_EQ_FLOAT(FOSSIL_STRIDED_AT(T, i), k) ? (int)i : -1; \
+    } \
+    \
+    static int fossil_strided_interpolation_##SUFFIX(const unsigned char *p, size_t n, size_t stride, T k, bool desc) \
+    { \
+        if (FOSSIL_NEAREST_IS_FLOAT(T)) \
+            return -4; \
+        size_t lo = 0, hi = n - 1; \
+        for (unsigned probes = 0; probes < FOSSIL_STRIDED_MAX_PROBES; ++probes) { \
+            T a = FOSSIL_STRIDED_AT(T, lo), b = FOSSIL_STRIDED_AT(T, hi); \
+            if (FOSSIL_SEARCH_BEFORE(k, a) || FOSSIL_SEARCH_BEFORE(b, k)) \
+                return -1; \
+            if (a == b) \
+                return a == k ? (int)lo : -1; \
+            double span = desc ? (double)a - (double)b : (double)b - (double)a; \
+            double off = desc ? (double)a - (double)k : (double)k - (double)a; \
+            size_t pos = lo + (size_t)((double)(hi - lo) * (off / span)); \
+            if (pos > hi) \
+                pos = hi; \
+            T x = FOSSIL_STRIDED_AT(T, pos); \
+            if (x == k) \
+                return (int)pos; \
+            if (FOSSIL_SEARCH_BEFORE(x, k)) \
+                lo = pos + 1; \
+            else \
+                hi = pos - 1; \
+            if (lo > hi) \
+                return -1; \
+        } \
+        size_t i = fossil_strided_bound_##SUFFIX(p, lo, hi - lo + 1, stride, k, desc); \
+        return i <= hi && FOSSIL_STRIDED_AT(T, i) == k ? (int)i : -1; \
+    } \
+    \
+    static int fossil_strided_##SUFFIX( \
+        const unsigned char *p, size_t n, size_t stride, const void *key, fossil_strided_algo_t algo, bool desc) \
+    { \
+        T k = *(const T *)key; \
+        switch (algo) { \
+        case FOSSIL_STRIDED_BINARY:        return fossil_strided_binary_##SUFFIX(p, n, stride, k, desc); \
+        case FOSSIL_STRIDED_INTERPOLATION: return fossil_strided_interpolation_##SUFFIX(p, n, stride, k, desc); \
+        default:                           return fossil_strided_linear_##SUFFIX(p, n, stride, k); \
+        } \
+    }
+
+FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_DEFINE_STRIDED)
+
+static int fossil_strided_kind(
+    const void *base, size_t count, size_t stride, const void *key,
+    fossil_search_ordered_t kind, fossil_strided_algo_t algo, bool desc)
+{
+    const unsigned char *p = (const unsigned char *)base;
+    switch (kind) {
+#define FOSSIL_SEARCH_CASE_STRIDED(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: return fossil_strided_##SUFFIX(p, count, stride, key, algo, desc);
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_STRIDED)
+#undef FOSSIL_SEARCH_CASE_STRIDED
+    default:
+        return -3;
+    }
+}
+
+static size_t fossil_search_ordered_sizeof(fossil_search_ordered_t kind)
+{
+    switch (kind) {
+#define FOSSIL_SEARCH_CASE_SIZEOF(NAME, SUFFIX, T) \
+    case FOSSIL_SEARCH_ORDERED_##NAME: return sizeof(T);
+    FOSSIL_SEARCH_FOREACH_ORDERED(FOSSIL_SEARCH_CASE_SIZEOF)
+#undef FOSSIL_SEARCH_CASE_SIZEOF
+    default:
+        return 0;
+    }
+}
+
+int fossil_algorithm_search_strided(
+    const void *base,
+    size_t count,
+    size_t stride,
+    size_t offset,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id)
+{
+    if (!base || !key || count == 0 || !type_id || stride == 0)
+        return -2; // invalid input
+
+    fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        kind = fossil_nearest_select_kind(type_id);
+    size_t field_size = kind != FOSSIL_SEARCH_ORDERED_NONE
+        ? fossil_search_ordered_sizeof(kind)
+        : fossil_algorithm_search_type_sizeof(type_id);
+    fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
+    if (field_size == 0 || (kind == FOSSIL_SEARCH_ORDERED_NONE && !cmp))
+        return -3; // unknown type
+    if (offset > stride || field_size > stride - offset)
+        return -2; // field does not fit in a record
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    const unsigned char *p = (const unsigned char *)base + offset;
+
+    fossil_strided_algo_t algo;
+    if (!algorithm_id || !strcmp(algorithm_id, "auto") || !strcmp(algorithm_id, "linear"))
+        algo = FOSSIL_STRIDED_LINEAR;
+    else if (!strcmp(algorithm_id, "binary"))
+        algo = FOSSIL_STRIDED_BINARY;
+    else if (!strcmp(algorithm_id, "interpolation"))
+        algo = FOSSIL_STRIDED_INTERPOLATION;
+    else if (!cmp)
+        return -4; // comparator-only algorithm on a typed-only kind
+    else if (!strcmp(algorithm_id, "jump"))
+        return search_jump(p, count, key, stride, cmp, desc);
+    else if (!strcmp(algorithm_id, "exponential"))
+        return search_exponential(p, count, key, stride, cmp, desc);
+    else if (!strcmp(algorithm_id, "fibonacci"))
+        return search_fibonacci(p, count, key, stride, cmp, desc);
+    else
+        return -4; // unknown algorithm
+
+    if (kind != FOSSIL_SEARCH_ORDERED_NONE)
+        return fossil_strided_kind(p, count, stride, key, kind, algo, desc);
+    if (algo == FOSSIL_STRIDED_INTERPOLATION)
+        return -4; // not a numeric field
+    if (algo == FOSSIL_STRIDED_BINARY)
+        return search_binary(p, count, key, stride, cmp, desc);
+    return search_linear(p, count, key, stride, cmp, desc);
+}
+
+// ======================================================
+// Parallel scan
+// ======================================================
+
+/**
+ * @brief Elements a worker scans between two looks at the shared result.
+ */
+#define FOSSIL_SEARCH_PARALLEL_BLOCK ((size_t)1 << 14)
+
+// Lowest match index published so far, SIZE_MAX while nothing is found. It
+// is read once per block and written once per worker at most, so a plain
+// lock costs nothing measurable next to the scan itself.
+typedef struct {
+    size_t first;
+#ifdef _WIN32
+    SRWLOCK lock;
+#else
+    pthread_mutex_t lock;
+#endif
+} fossil_pscan_shared_t;
+
+static size_t fossil_pscan_load(fossil_pscan_shared_t *shared)
+{
+#ifdef _WIN32
+    AcquireSRWLockShared(&shared->lock);
+    size_t first = shared->first;
+    ReleaseSRWLockShared(&shared->lock);
+#else
+    pthread_mutex_lock(&shared->lock);
+    size_t first = shared->first;
+    pthread_mutex_unlock(&shared->lock);
+#endif
+    return first;
+}
+
+static void fossil_pscan_publish(fossil_pscan_shared_t *shared, size_t index)
+{
+#ifdef _WIN32
+    AcquireSRWLockExclusive(&shared->lock);
+    if (index < shared->first)
+        shared->first = index;
+    ReleaseSRWLockExclusive(&shared->lock);
+#else
+    pthread_mutex_lock(&shared->lock);
+    if (index < shared->first)
+        shared->first = index;
+    pthread_mutex_unlock(&shared->lock);
+#endif
+}
+
+// One worker of a parallel scan. Blocks are dealt round-robin, so the
+// workers sweep the array front to back together and a match early in the
+// array ends every worker soon after it is published.
+typedef struct {
+    const unsigned char *base;
+    size_t count;
+    size_t size;
+    size_t first_block;
+    size_t stride;
+    const void *key;
+    fossil_search_kind_t kind;
+    fossil_search_compare_fn cmp;
+    bool any;
+    fossil_pscan_shared_t *shared;
+} fossil_pscan_job_t;
+
+static void fossil_pscan_job(void *arg)
+{
+    fossil_pscan_job_t *job = (fossil_pscan_job_t *)arg;
+    for (size_t start = job->first_block * FOSSIL_SEARCH_PARALLEL_BLOCK; start < job->count;
+         start += job->stride * FOSSIL_SEARCH_PARALLEL_BLOCK) {
+        // A match below this block is final for "first"; any match is for "any".
+        size_t first = fossil_pscan_load(job->shared);
+        if (first != SIZE_MAX && (job->any || first < start))
+            return;
+
+        size_t n = job->count - start < FOSSIL_SEARCH_PARALLEL_BLOCK ? job->count - start : FOSSIL_SEARCH_PARALLEL_BLOCK;
+        const unsigned char *block = job->base + start * job->size;
+        int hit = job->kind != FOSSIL_SEARCH_KIND_NONE
+            ? fossil_search_scan_kind(block, n, job->key, job->kind)
+            : search_linear(block, n, job->key, job->size, job->cmp, false);
+        if (hit >= 0) {
+            fossil_pscan_publish(job->shared, start + (size_t)hit);
+            return;
+        }
+    }
+}
+
+int fossil_algorithm_search_parallel(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *mode_id,
+    size_t threads,
+    size_t *index)
+{
+    if (!base || !key || !type_id || !index)
+        return -2; // invalid input
+
+    bool any;
+    if (!mode_id || !strcmp(mode_id, "first"))
+        any = false;
+    else if (!strcmp(mode_id, "any"))
+        any = true;
+    else
+        return -4; // unknown mode
+
+    size_t type_size = fossil_algorithm_search_type_sizeof(type_id);
+    fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
+    if (type_size == 0 || !cmp)
+        return -3; // unknown type
+
+    if (threads == 0)
+        threads = fossil_algorithm_cpu_count();
+    if (threads > FOSSIL_ALGORITHM_MAX_THREADS)
+        threads = FOSSIL_ALGORITHM_MAX_THREADS;
+    if (threads > count / FOSSIL_SEARCH_THREAD_MIN_CHUNK)
+        threads = count / FOSSIL_SEARCH_THREAD_MIN_CHUNK;
+    if (threads == 0)
+        threads = 1;
+
+    fossil_pscan_shared_t shared;
+    shared.first = SIZE_MAX;
+#ifdef _WIN32
+    InitializeSRWLock(&shared.lock);
+#else
+    if (pthread_mutex_init(&shared.lock, NULL) != 0)
+        return -5; // out of resources
+#endif
+
+    fossil_pscan_job_t jobs[FOSSIL_ALGORITHM_MAX_THREADS];
+    for (size_t t = 0; t < threads; ++t) {
+        fossil_pscan_job_t *job = &jobs[t];
+        job->base = (const unsigned char *)base;
+        job->count = count;
+        job->size = type_size;
+        job->first_block = t;
+        job->stride = threads;
+        job->key = key;
+        job->kind = fossil_search_select_kind(type_id);
+        job->cmp = cmp;
+        job->any = any;
+        job->shared = &shared;
+    }
+    fossil_algorithm_run_parallel(fossil_pscan_job, jobs, sizeof(jobs[0]), threads);
+
+#ifndef _WIN32
+    pthread_mutex_destroy(&shared.lock);
+#endif
+    if (shared.first == SIZE_MAX)
+        return -1; // not found
+    *index = shared.first;
+    return 0;
+}
+
+// ======================================================
+// Subsequence search
+// ======================================================
+
+/**
+ * @brief Verification work the first/last filter may spend beyond one
+ *        element per haystack position before handing over to Two-Way.
+ */
+#define FOSSIL_SUBSEQ_SLACK 4096
+
+// Subsequences match element bytes exactly, so every fixed-width integer
+// layout collapses to its width. Floats are excluded: bit equality would
+// tell 0.0 from -0.0 and NaN payloads apart, unlike the comparators.
+static size_t fossil_subseq_select_width(const char *type_id)
+{
+    if (!strcmp(type_id, "f32") || !strcmp(type_id, "f64"))
+        return 0;
+    switch (fossil_search_select_kind(type_id)) {
+    case FOSSIL_SEARCH_KIND_W8:  return 1;
+    case FOSSIL_SEARCH_KIND_W16: return 2;
+    case FOSSIL_SEARCH_KIND_W32: return 4;
+    case FOSSIL_SEARCH_KIND_W64: return 8;
+    default:
+        break;
+    }
+    return fossil_nearest_select_kind(type_id) != FOSSIL_SEARCH_ORDERED_NONE ? 8 : 0;
+}
+
+// Records a match; true once limit matches are stored.
+#define FOSSIL_SUBSEQ_EMIT(j) \
+    do { \
+        if (out) out[found] = (j); \
+        if (++found == limit) return found; \
+    } while (0)
+
+// Per-width kernels, each returning the number of matches stored (at most
+// limit, out may be NULL to count):
+//  - factor: critical factorisation of the needle (Crochemore-Perrin), the
+//    start of its right half and the local period there.
+//  - twoway: Two-Way matching from position j, linear in the haystack with
+//    O(1) extra space whatever the needle.
+//  - run: filters positions by the first and last needle element four at a
+//    time and verifies the rest; a needle that keeps passing the filter
+//    without matching exhausts the work budget and the remaining haystack
+//    goes to Two-Way, so the worst case stays linear.
+#define FOSSIL_SEARCH_DEFINE_SUBSEQ(SUFFIX, T) \
+    static size_t fossil_subseq_factor_##SUFFIX(const T *x, size_t m, size_t *period) \
+    { \
+        size_t ms = SIZE_MAX, j = 0, k = 1, p = 1; \
+        while (j + k < m) { \
+            T a = x[j + k], b = x[ms + k]; \
+            if (a < b) { j += k; k = 1; p = j - ms; } \
+            else if (a == b) { if (k != p) ++k; else { j += p; k = 1; } } \
+            else { ms = j++; k = p = 1; } \
+        } \
+        *period = p; \
+        size_t rs = SIZE_MAX; \
+        j = 0; k = p = 1; \
+        while (j + k < m) { \
+            T a = x[j + k], b = x[rs + k]; \
+            if (b < a) { j += k; k = 1; p = j - rs; } \
+            else if (a == b) { if (k != p) ++k; else { j += p; k = 1; } } \
+            else { rs = j++; k = p = 1; } \
+        } \
+        if (rs + 1 < ms + 1) \
+            return ms + 1; \
+        *period = p; \
+        return rs + 1; \
+    } \
+    \
+    static size_t fossil_subseq_twoway_##SUFFIX( \
+        const T *h, size_t n, const T *x, size_t m, size_t j, size_t *out, size_t limit) \
+    { \
+        size_t period, found = 0; \
+        size_t suffix = fossil_subseq_factor_##SUFFIX(x, m, &period); \
+        if (memcmp(x, x + period, suffix * sizeof(T)) == 0) { \
+            /* Periodic needle: remember the prefix already matched. */ \
+            size_t memory = 0; \
+            while (j <= n - m) { \
+                size_t i = suffix > memory ? suffix : memory; \
+                while (i < m && x[i] == h[i + j]) ++i; \
+                if (i >= m) { \
+                    i = suffix - 1; \
+                    while (memory < i + 1 && x[i] == h[i + j]) --i; \
+                    if (i + 1 < memory + 1) \
+                        FOSSIL_SUBSEQ_EMIT(j); \
+                    j += period; \
+                    memory = m - period; \
+                } else { \
+                    j += i - suffix + 1; \
+                    memory = 0; \
+                } \
+            } \
+        } else { \
+            period = (suffix > m - suffix ? suffix : m - suffix) + 1; \
+            while (j <= n - m) { \
+                size_t i = suffix; \
+                while (i < m && x[i] == h[i + j]) ++i; \
+                if (i >= m) { \
+                    i = suffix - 1; \
+                    while (i != SIZE_MAX && x[i] == h[i + j]) --i; \
+                    if (i == SIZE_MAX) \
+                        FOSSIL_SUBSEQ_EMIT(j); \
+                    j += period; \
+                } else { \
+                    j += i - suffix + 1; \
+                } \
+            } \
+        } \
+        return found; \
+    } \
+    \
+    static size_t fossil_subseq_run_##SUFFIX( \
+        const T *h, size_t n, const T *x, size_t m, size_t *out, size_t limit) \
+    { \
+        const T f = x[0], l = x[m - 1]; \
+        const T *t = h + m - 1; \
+        size_t found = 0, work = 0, j = 0, last = n - m; \
+        for (;;) { \
+            while (j + 3 <= last && \
+                   !(((h[j] == f) & (t[j] == l)) | ((h[j + 1] == f) & (t[j + 1] == l)) | \
+                     ((h[j + 2] == f) & (t[j + 2] == l)) | ((h[j + 3] == f) & (t[j + 3] == l)))) \
+                j += 4; \
+            while (j <= last && !((h[j] == f) & (t[j] == l))) \
+                ++j; \
+            if (j > last) \
+                return found; \
+            size_t i = 1; \
+            while (i + 1 < m && h[j + i] == x[i]) \
+                ++i; \
+            work += i; \
+            if (i + 1 >= m) \
+                FOSSIL_SUBSEQ_EMIT(j); \
+            ++j; \
+            if (work > j + FOSSIL_SUBSEQ_SLACK && j <= last) \
+                return found + fossil_subseq_twoway_##SUFFIX(h, n, x, m, j, out ? out + found : NULL, limit - found); \
+        } \
+    }
+
+FOSSIL_SEARCH_DEFINE_SUBSEQ(w8,  uint8_t)
+FOSSIL_SEARCH_DEFINE_SUBSEQ(w16, uint16_t)
+FOSSIL_SEARCH_DEFINE_SUBSEQ(w32, uint32_t)
+FOSSIL_SEARCH_DEFINE_SUBSEQ(w64, uint64_t)
+
+#undef FOSSIL_SUBSEQ_EMIT
+
+static size_t fossil_subseq_run(
+    const void *h, size_t n, const void *x, size_t m, size_t width, size_t *out, size_t limit)
+{
+    switch (width) {
+    case 1:  return fossil_subseq_run_w8((const uint8_t *)h, n, (const uint8_t *)x, m, out, limit);
+    case 2:  return fossil_subseq_run_w16((const uint16_t *)h, n, (const uint16_t *)x, m, out, limit);
+    case 4:  return fossil_subseq_run_w32((const uint32_t *)h, n, (const uint32_t *)x, m, out, limit);
+    default: return fossil_subseq_run_w64((const uint64_t *)h, n, (const uint64_t *)x, m, out, limit);
+    }
+}
+
+int fossil_algorithm_search_subsequence(
+    const void *base,
+    size_t count,
+    const void *needle,
+    size_t needle_count,
+    const char *type_id)
+{
+    if (!base || !needle || needle_count == 0 || !type_id)
+        return -2; // invalid input
+
+    size_t width = fossil_subseq_select_width(type_id);
+    if (width == 0)
+        return -3; // unknown or non-integer type
+    if (needle_count > count)
+        return -1; // not found
+
+    size_t index;
+    if (fossil_subseq_run(base, count, needle, needle_count, width, &index, 1) == 0)
+        return -1; // not found
+    return (int)index;
+}
+
+int fossil_algorithm_search_subsequence_all(
+    const void *base,
+    size_t count,
+    const void *needle,
+    size_t needle_count,
+    const char *type_id,
+    size_t *indices,
+    size_t *match_count)
+{
+    if (!base || !needle || needle_count == 0 || !type_id || !match_count)
+        return -2; // invalid input
+
+    size_t width = fossil_subseq_select_width(type_id);
+    if (width == 0)
+        return -3; // unknown or non-integer type
+
+    *match_count = needle_count > count
+        ? 0
+        : fossil_subseq_run(base, count, needle, needle_count, width, indices, SIZE_MAX);
+    return 0;
+}
+
+// Multi-pattern search: an Aho-Corasick automaton over element bytes with a
+// full 256-way transition table, so each haystack byte costs one table
+// load. A pattern ending at byte e only counts when it starts on an element
+// boundary. Identical patterns share a state and report the lowest index.
+#define FOSSIL_PATTERNS_NONE UINT32_MAX
+
+struct fossil_algorithm_search_patterns {
+    size_t width;
+    size_t max_bytes;
+    size_t state_count;
+    uint32_t *next;     // state_count * 256 transitions
+    uint32_t *fail;
+    uint32_t *output;   // pattern ending at a state, or NONE
+    uint32_t *dict;     // nearest proper suffix state with an output, or 0
+    size_t *bytes;      // byte length per pattern
+};
+
+fossil_algorithm_search_patterns_t *fossil_algorithm_search_patterns_create(
+    const void *const *patterns,
+    const size_t *lengths,
+    size_t pattern_count,
+    const char *type_id)
+{
+    if (!patterns || !lengths || pattern_count == 0 || !type_id)
+        return NULL;
+    size_t width = fossil_subseq_select_width(type_id);
+    if (width == 0)
+        return NULL;
+
+    size_t total = 1;
+    for (size_t p = 0; p < pattern_count; ++p) {
+        if (!patterns[p] || lengths[p] == 0 || lengths[p] > (SIZE_MAX - total) / width)
+            return NULL;
+        total += lengths[p] * width;
+    }
+    if (total >= FOSSIL_PATTERNS_NONE || pattern_count >= FOSSIL_PATTERNS_NONE)
+        return NULL;
+
+    fossil_algorithm_search_patterns_t *set = calloc(1, sizeof(*set));
+    if (!set)
+        return NULL;
+    set->width = width;
+    set->next = calloc(total, 256 * sizeof(uint32_t));
+    set->fail = calloc(total, sizeof(uint32_t));
+    set->output = malloc(total * sizeof(uint32_t));
+    set->dict = calloc(total, sizeof(uint32_t));
+    set->bytes = malloc(pattern_count * sizeof(size_t));
+    if (!set->next || !set->fail || !set->output || !set->dict || !set->bytes) {
+        fossil_algorithm_search_patterns_destroy(set);
+        return NULL;
+    }
+
+    // Trie; a zero transition means "no child" until the automaton is closed.
+    size_t states = 1;
+    set->output[0] = FOSSIL_PATTERNS_NONE;
+    for (size_t p = 0; p < pattern_count; ++p) {
+        const unsigned char *s = (const unsigned char *)patterns[p];
+        size_t len = lengths[p] * width;
+        uint32_t at = 0;
+        for (size_t i = 0; i < len; ++i) {
+            uint32_t *slot = &set->next[(size_t)at * 256 + s[i]];
+            if (*slot == 0) {
+                set->output[states] = FOSSIL_PATTERNS_NONE;
+                *slot = (uint32_t)states++;
+            }
+            at = *slot;
+        }
+        if (set->output[at] == FOSSIL_PATTERNS_NONE)
+            set->output[at] = (uint32_t)p;
+        set->bytes[p] = len;
+        if (len > set->max_bytes)
+            set->max_bytes = len;
+    }
+    set->state_count = states;
+
+    // Breadth-first closure: fail links, output links and the missing
+    // transitions, each row filled from the already complete fail row.
+    size_t head = 0, tail = 0;
+    uint32_t *order = malloc(states * sizeof(uint32_t));
+    if (!order) {
+        fossil_algorithm_search_patterns_destroy(set);
+        return NULL;
+    }
+    order[tail++] = 0;
+    while (head < tail) {
+        uint32_t s = order[head++];
+        uint32_t *row = &set->next[(size_t)s * 256];
+        const uint32_t *fail_row = &set->next[(size_t)set->fail[s] * 256];
+        for (size_t c = 0; c < 256; ++c) {
+            uint32_t t = row[c];
+            if (t != 0) {
+                uint32_t f = s == 0 ? 0 : fail_row[c];
+                set->fail[t] = f;
+                set->dict[t] = set->output[f] != FOSSIL_PATTERNS_NONE ? f : set->dict[f];
+                order[tail++] = t;
+            } else {
+                row[c] = s == 0 ? 0 : fail_row[c];
+            }
+        }
+    }
+    free(order);
+    return set;
+}
+
+void fossil_algorithm_search_patterns_destroy(fossil_algorithm_search_patterns_t *set)
+{
+    if (!set)
+        return;
+    free(set->next);
+    free(set->fail);
+    free(set->output);
+    free(set->dict);
+    free(set->bytes);
+    free(set);
+}
+
+// Scans the haystack and hands every aligned match to the caller through
+// out/ids (up to capacity) in the order the matches end. With first set it
+// stops once no match can start before the best one found, and stores only
+// that one.
+static size_t fossil_patterns_scan(
+    const fossil_algorithm_search_patterns_t *set, const void *base, size_t count,
+    size_t *out, size_t *ids, size_t capacity, bool first)
+{
+    const unsigned char *h = (const unsigned char *)base;
+    size_t n = count * set->width, found = 0;
+    size_t best = SIZE_MAX, best_id = 0;
+    uint32_t state = 0;
+    for (size_t pos = 0; pos < n; ++pos) {
+        if (first && best != SIZE_MAX && pos >= best * set->width + set->max_bytes)
+            break;
+        state = set->next[(size_t)state * 256 + h[pos]];
+        uint32_t o = set->output[state] != FOSSIL_PATTERNS_NONE ? state : set->dict[state];
+        for (; o != 0; o = set->dict[o]) {
+            uint32_t p = set->output[o];
+            size_t start = pos + 1 - set->bytes[p];
+            if (start % set->width != 0)
+                continue;
+            start /= set->width;
+            if (first) {
+                if (start < best || (start == best && p < best_id)) {
+                    best = start;
+                    best_id = p;
+                }
+                continue;
+            }
+            if (found < capacity) {
+                if (out) out[found] = start;
+                if (ids) ids[found] = p;
+            }
+            ++found;
+        }
+    }
+    if (first && best != SIZE_MAX) {
+        out[0] = best;
+        if (ids) ids[0] = best_id;
+        return 1;
+    }
+    return found;
+}
+
+int fossil_algorithm_search_patterns_find(
+    const fossil_algorithm_search_patterns_t *set,
+    const void *base,
+    size_t count,
+    size_t *pattern)
+{
+    if (!set || !base)
+        return -2; // invalid input
+    size_t index;
+    if (fossil_patterns_scan(set, base, count, &index, pattern, 1, true) == 0)
+        return -1; // not found
+    return (int)index;
+}
+
+int fossil_algorithm_search_patterns_find_all(
+    const fossil_algorithm_search_patterns_t *set,
+    const void *base,
+    size_t count,
+    size_t *indices,
+    size_t *pattern_ids,
+    size_t capacity,
+    size_t *match_count)
+{
+    if (!set || !base || !match_count)
+        return -2; // invalid input
+    *match_count = fossil_patterns_scan(set, base, count, indices, pattern_ids, capacity, false);
+    return 0;
+}
+
+// ======================================================
+// Membership filters
+// ======================================================
+
+typedef enum {
+    FOSSIL_FILTER_BLOOM,
+    FOSSIL_FILTER_XOR
+} fossil_filter_method_t;
+
+/**
+ * @brief Default Bloom budget: about 1.3% false positives.
+ */
+#define FOSSIL_FILTER_BLOOM_DEFAULT_BITS 10.0
+
+/**
+ * @brief Seeds tried before xor filter construction gives up.
+ */
+#define FOSSIL_FILTER_XOR_ATTEMPTS 64
+
+struct fossil_algorithm_search_filter {
+    fossil_filter_method_t method;
+    fossil_search_ordered_t kind;   // NONE for "cstr"
+    size_t width;
+    size_t key_count;
+    bool has_nan;                   // NaN compares equal to every key
+    uint64_t seed;
+    uint32_t *blocks;               // Bloom: 8 words per 256-bit block
+    size_t block_count;
+    uint8_t *fingerprints;          // xor: three segments of segment_length
+    size_t segment_length;
+    double false_positive_rate;
+};
+
+static uint64_t fossil_filter_mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Key hash independent of the filter seed. Values hash by their bytes,
+// with -0.0 folded onto 0.0 so that keys equal under the comparators hash
+// alike; strings hash by content, NULL as "".
+static uint64_t fossil_filter_key_hash(const fossil_algorithm_search_filter_t *f, const void *key, bool *is_nan)
+{
+    *is_nan = false;
+    if (f->kind == FOSSIL_SEARCH_ORDERED_NONE) {
+        const char *s = *(const char *const *)key;
+        size_t len = s ? strlen(s) : 0;
+        uint64_t h = 0x9e3779b97f4a7c15ULL ^ len;
+        size_t i = 0;
+        for (; i + 8 <= len; i += 8) {
+            uint64_t chunk;
+            memcpy(&chunk, s + i, 8);
+            h = fossil_filter_mix(h ^ chunk);
+        }
+        uint64_t tail = 0;
+        memcpy(&tail, s ? s + i : "", len - i);
+        return fossil_filter_mix(h ^ tail);
+    }
+    uint64_t bits = 0;
+    if (f->kind == FOSSIL_SEARCH_ORDERED_F32) {
+        float v = *(const float *)key;
+        *is_nan = isnan(v) != 0;
+        if (v == 0.0f)
+            v = 0.0f;
+        uint32_t b;
+        memcpy(&b, &v, sizeof(b));
+        bits = b;
+    } else if (f->kind == FOSSIL_SEARCH_ORDERED_F64) {
+        double v = *(const double *)key;
+        *is_nan = isnan(v) != 0;
+        if (v == 0.0)
+            v = 0.0;
+        memcpy(&bits, &v, sizeof(bits));
+    } else {
+        switch (f->width) {
+        case 1: bits = *(const uint8_t *)key; break;
+        case 2: bits = *(const uint16_t *)key; break;
+        case 4: bits = *(const uint32_t *)key; break;
+        default: bits = *(const uint64_t *)key; break;
+        }
+    }
+    return fossil_filter_mix(bits ^ 0x9e3779b97f4a7c15ULL);
+}
+
+static uint32_t fossil_filter_reduce(uint32_t hash, size_t n)
+{
+    return (uint32_t)(((uint64_t)hash * (uint64_t)n) >> 32);
+}
+
+static unsigned fossil_filter_popcount32(uint32_t x)
+{
+    x = x - ((x >> 1) & 0x55555555u);
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    x = (x + (x >> 4)) & 0x0f0f0f0fu;
+    return (x * 0x01010101u) >> 24;
+}
+
+// Split-block Bloom filter: the high hash half picks a 256-bit block, the
+// low half sets one bit in each of its eight words through eight odd
+// multipliers. A probe touches one cache line and its eight tests are
+// independent, which compilers turn into a vector compare.
+static const uint32_t fossil_filter_salt[8] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+};
+
+static void fossil_filter_bloom_add(fossil_algorithm_search_filter_t *f, uint64_t h)
+{
+    uint32_t *block = f->blocks + (size_t)fossil_filter_reduce((uint32_t)(h >> 32), f->block_count) * 8;
+    for (unsigned i = 0; i < 8; ++i)
+        block[i] |= 1u << (((uint32_t)h * fossil_filter_salt[i]) >> 27);
+}
+
+static bool fossil_filter_bloom_test(const fossil_algorithm_search_filter_t *f, uint64_t h)
+{
+    const uint32_t *block = f->blocks + (size_t)fossil_filter_reduce((uint32_t)(h >> 32), f->block_count) * 8;
+    uint32_t miss = 0;
+    for (unsigned i = 0; i < 8; ++i)
+        miss |= ~block[i] & (1u << (((uint32_t)h * fossil_filter_salt[i]) >> 27));
+    return miss == 0;
+}
+
+// Xor filter with 8-bit fingerprints: each key maps to one slot in each of
+// three segments, and the slots XOR to the key's fingerprint.
+static uint8_t fossil_filter_fingerprint(uint64_t h)
+{
+    return (uint8_t)(h ^ (h >> 32));
+}
+
+static size_t fossil_filter_xor_slot(const fossil_algorithm_search_filter_t *f, uint64_t h, unsigned segment)
+{
+    uint64_t r = segment ? (h << (21 * segment)) | (h >> (64 - 21 * segment)) : h;
+    return segment * f->segment_length + fossil_filter_reduce((uint32_t)r, f->segment_length);
+}
+
+static bool fossil_filter_xor_test(const fossil_algorithm_search_filter_t *f, uint64_t key_hash)
+{
+    uint64_t h = fossil_filter_mix(key_hash + f->seed);
+    uint8_t x = f->fingerprints[fossil_filter_xor_slot(f, h, 0)] ^
+                f->fingerprints[fossil_filter_xor_slot(f, h, 1)] ^
+                f->fingerprints[fossil_filter_xor_slot(f, h, 2)];
+    return x == fossil_filter_fingerprint(h);
+}
+
+// Peels keys off slots used by a single remaining key; every key peeled
+// this way can be given a slot of its own, so the fingerprints solve in
+// reverse peel order. Fails (for this seed) when a cycle is left.
+static bool fossil_filter_xor_build(fossil_algorithm_search_filter_t *f, const uint64_t *keys, size_t n)
+{
+    size_t capacity = 3 * f->segment_length;
+    uint64_t *mask = calloc(capacity, sizeof(uint64_t));
+    uint32_t *degree = calloc(capacity, sizeof(uint32_t));
+    size_t *queue = malloc(capacity * sizeof(size_t));
+    uint64_t *stack_hash = malloc(n * sizeof(uint64_t));
+    size_t *stack_slot = malloc(n * sizeof(size_t));
+    bool ok = false;
+    if (!mask || !degree || !queue || !stack_hash || !stack_slot)
+        goto done;
+
+    for (unsigned attempt = 0; attempt < FOSSIL_FILTER_XOR_ATTEMPTS && !ok; ++attempt) {
+        f->seed = fossil_filter_mix(f->seed + 0x9e3779b97f4a7c15ULL);
+        memset(mask, 0, capacity * sizeof(uint64_t));
+        memset(degree, 0, capacity * sizeof(uint32_t));
+        for (size_t i = 0; i < n; ++i) {
+            uint64_t h = fossil_filter_mix(keys[i] + f->seed);
+            for (unsigned s = 0; s < 3; ++s) {
+                size_t slot = fossil_filter_xor_slot(f, h, s);
+                mask[slot] ^= h;
+                ++degree[slot];
+            }
+        }
+        size_t head = 0, tail = 0, peeled = 0;
+        for (size_t slot = 0; slot < capacity; ++slot)
+            if (degree[slot] == 1)
+                queue[tail++] = slot;
+        while (head < tail) {
+            size_t slot = queue[head++];
+            if (degree[slot] != 1)
+                continue;
+            uint64_t h = mask[slot];
+            stack_hash[peeled] = h;
+            stack_slot[peeled++] = slot;
+            for (unsigned s = 0; s < 3; ++s) {
+                size_t other = fossil_filter_xor_slot(f, h, s);
+                mask[other] ^= h;
+                if (--degree[other] == 1)
+                    queue[tail++] = other;
+            }
+        }
+        ok = (peeled == n);
+    }
+    if (ok) {
+        memset(f->fingerprints, 0, capacity);
+        for (size_t i = n; i-- > 0;) {
+            uint64_t h = stack_hash[i];
+            f->fingerprints[stack_slot[i]] = (uint8_t)(fossil_filter_fingerprint(h) ^
+                f->fingerprints[fossil_filter_xor_slot(f, h, 0)] ^
+                f->fingerprints[fossil_filter_xor_slot(f, h, 1)] ^
+                f->fingerprints[fossil_filter_xor_slot(f, h, 2)]);
+        }
+    }
+done:
+    free(mask);
+    free(degree);
+    free(queue);
+    free(stack_hash);
+    free(stack_slot);
+    return ok;
+}
+
+fossil_algorithm_search_filter_t *fossil_algorithm_search_filter_create(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *method_id,
+    double bits_per_key)
+{
+    if (!base || count == 0 || !type_id)
+        return NULL;
+
+    fossil_filter_method_t method;
+    if (!method_id || !strcmp(method_id, "bloom"))
+        method = FOSSIL_FILTER_BLOOM;
+    else if (!strcmp(method_id, "xor"))
+        method = FOSSIL_FILTER_XOR;
+    else
+        return NULL;
+    if (!(bits_per_key >= 0.0) || bits_per_key > 64.0)
+        return NULL;
+    if (bits_per_key == 0.0)
+        bits_per_key = FOSSIL_FILTER_BLOOM_DEFAULT_BITS;
+
+    fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        kind = fossil_nearest_select_kind(type_id);
+    size_t width = kind != FOSSIL_SEARCH_ORDERED_NONE ? fossil_search_ordered_sizeof(kind) : 0;
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE && strcmp(type_id, "cstr") != 0)
+        return NULL;
+    size_t elem_size = width ? width : sizeof(char *);
+
+    fossil_algorithm_search_filter_t *f = calloc(1, sizeof(*f));
+    uint64_t *keys = malloc(count * sizeof(uint64_t));
+    if (!f || !keys) {
+        free(keys);
+        free(f);
+        return NULL;
+    }
+    f->method = method;
+    f->kind = kind;
+    f->width = width;
+
+    size_t n = 0;
+    for (size_t i = 0; i < count; ++i) {
+        bool is_nan;
+        uint64_t h = fossil_filter_key_hash(f, (const unsigned char *)base + i * elem_size, &is_nan);
+        if (is_nan)
+            f->has_nan = true;
+        else
+            keys[n++] = h;
+    }
+
+    bool ok = true;
+    if (method == FOSSIL_FILTER_BLOOM) {
+        double blocks = ceil((double)n * bits_per_key / 256.0);
+        if (blocks <= (double)UINT32_MAX) {
+            f->block_count = blocks < 1.0 ? 1 : (size_t)blocks;
+            f->blocks = calloc(f->block_count * 8, sizeof(uint32_t));
+        }
+        if (f->blocks) {
+            for (size_t i = 0; i < n; ++i)
+                fossil_filter_bloom_add(f, keys[i]);
+            // Exact for the built bit pattern: a random key passes a block
+            // with the product of its eight word densities.
+            double sum = 0.0;
+            for (size_t b = 0; b < f->block_count; ++b) {
+                double p = 1.0;
+                for (unsigned i = 0; i < 8; ++i)
+                    p *= fossil_filter_popcount32(f->blocks[b * 8 + i]) / 32.0;
+                sum += p;
+            }
+            f->false_positive_rate = sum / (double)f->block_count;
+        } else {
+            ok = false;
+        }
+    } else {
+        // Peeling needs distinct keys.
+        if (n > 1 && fossil_algorithm_sort_exec(keys, n, "u64", "auto", "asc") != 0)
+            ok = false;
+        size_t m = 0;
+        for (size_t i = 0; ok && i < n; ++i)
+            if (m == 0 || keys[i] != keys[m - 1])
+                keys[m++] = keys[i];
+        n = m;
+        f->segment_length = (32 + (size_t)ceil(1.23 * (double)n)) / 3;
+        f->fingerprints = ok ? malloc(3 * f->segment_length) : NULL;
+        ok = f->fingerprints && f->segment_length <= UINT32_MAX && fossil_filter_xor_build(f, keys, n);
+        f->false_positive_rate = 1.0 / 256.0;
+    }
+    f->key_count = n;
+    if (f->has_nan)
+        f->false_positive_rate = 1.0;
+    free(keys);
+    if (!ok) {
+        fossil_algorithm_search_filter_destroy(f);
+        return NULL;
+    }
+    return f;
+}
+
+void fossil_algorithm_search_filter_destroy(fossil_algorithm_search_filter_t *filter)
+{
+    if (!filter)
+        return;
+    free(filter->blocks);
+    free(filter->fingerprints);
+    free(filter);
+}
+
+bool fossil_algorithm_search_filter_contains(const fossil_algorithm_search_filter_t *filter, const void *key)
+{
+    if (!filter || !key)
+        return false;
+    if (filter->has_nan)
+        return true;
+    bool is_nan;
+    uint64_t h = fossil_filter_key_hash(filter, key, &is_nan);
+    if (is_nan)
+        return true;
+    if (filter->method == FOSSIL_FILTER_BLOOM)
+        return fossil_filter_bloom_test(filter, h);
+    return fossil_filter_xor_test(filter, h);
+}
+
+int fossil_algorithm_search_filter_stats(
+    const fossil_algorithm_search_filter_t *filter,
+    fossil_algorithm_search_filter_stats_t *out)
+{
+    if (!filter || !out)
+        return -2; // invalid input
+    out->key_count = filter->key_count;
+    out->memory_bytes = filter->method == FOSSIL_FILTER_BLOOM
+        ? filter->block_count * 8 * sizeof(uint32_t)
+        : 3 * filter->segment_length;
+    out->bits_per_key = filter->key_count ? 8.0 * (double)out->memory_bytes / (double)filter->key_count : 0.0;
+    out->false_positive_rate = filter->false_positive_rate;
+    return 0;
+}
+
+int fossil_algorithm_search_exec_filtered(
+    const fossil_algorithm_search_filter_t *filter,
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id)
+{
+    if (!filter || !base || !key || count == 0 || !type_id)
+        return -2; // invalid input
+
+    fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+    if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+        kind = fossil_nearest_select_kind(type_id);
+    if (kind != filter->kind || (kind == FOSSIL_SEARCH_ORDERED_NONE && strcmp(type_id, "cstr") != 0))
+        return -3; // not the type the filter was built for
+
+    if (!fossil_algorithm_search_filter_contains(filter, key))
+        return -1; // definitely absent
+
+    // "datetime" and "duration" have no exec comparator; search them with
+    // their i64 layout, as the filter hashed them.
+    if (kind == FOSSIL_SEARCH_ORDERED_I64 && fossil_algorithm_search_type_sizeof(type_id) == 0)
+        type_id = "i64";
+    return fossil_algorithm_search_exec(base, count, key, type_id, algorithm_id, order_id);
+}
+
+// ======================================================
+// Dispatcher
+// ======================================================
+
+int fossil_algorithm_search_exec(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id)
+{
+    if (!base || !key || count == 0 || !type_id)
+        return -2; // invalid input
+
+    // Small-input fast path: typed scan before any further string resolution.
+    if (count <= FOSSIL_SEARCH_SMALL_MAX &&
+        (!algorithm_id || !strcmp(algorithm_id, "auto") || !strcmp(algorithm_id, "linear"))) {
+        fossil_search_kind_t kind = fossil_search_select_kind(type_id);
+        if (kind != FOSSIL_SEARCH_KIND_NONE)
+            return fossil_search_scan_kind(base, count, key, kind);
+    }
+
+    size_t type_size = fossil_algorithm_search_type_sizeof(type_id);
+    if (type_size == 0)
+        return -3; // unknown type
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    fossil_search_compare_fn cmp = fossil_search_select_comparator(type_id);
+    if (!cmp)
+        return -3; // unknown type
+
+    if (!algorithm_id || !strcmp(algorithm_id, "auto") || !strcmp(algorithm_id, "linear"))
+        return search_linear(base, count, key, type_size, cmp, desc);
+
+    if (!strcmp(algorithm_id, "binary"))
+        return search_binary(base, count, key, type_size, cmp, desc);
+
+    if (!strcmp(algorithm_id, "jump"))
+        return search_jump(base, count, key, type_size, cmp, desc);
+
+    if (!strcmp(algorithm_id, "interpolation")) {
+        // Integer kinds only; the kernel is chosen by type, not by width
+        fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+        if (kind == FOSSIL_SEARCH_ORDERED_NONE)
+            return -4;
+        return fossil_strided_kind(base, count, type_size, key, kind, FOSSIL_STRIDED_INTERPOLATION, desc);
+    }
+
+    if (!strcmp(algorithm_id, "exponential"))
+        return search_exponential(base, count, key, type_size, cmp, desc);
+
+    if (!strcmp(algorithm_id, "fibonacci"))
+        return search_fibonacci(base, count, key, type_size, cmp, desc);
+
+    if (!strcmp(algorithm_id, "parallel")) {
+        size_t index;
+        int status = fossil_algorithm_search_parallel(base, count, key, type_id, "first", 0, &index);
+        return status == 0 ? (int)index : status;
+    }
+
+    return -4; // unknown algorithm
+}
+
+int fossil_algorithm_search_exec_checked(
+    const void *base,
+    size_t count,
+    const void *key,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id)
+{
+    if (!base || !key || count == 0 || !type_id)
+        return -2; // invalid input
+
+    // Only algorithms exec would actually run on sorted input are checked, so
+    // unknown types and algorithms get exec's own -3 / -4 whatever the order.
+    bool needs_order = false;
+    if (algorithm_id) {
+        if (!strcmp(algorithm_id, "interpolation")) {
+            fossil_search_ordered_t kind = fossil_search_select_ordered(type_id);
+            needs_order = kind != FOSSIL_SEARCH_ORDERED_NONE &&
+                          kind != FOSSIL_SEARCH_ORDERED_F32 && kind != FOSSIL_SEARCH_ORDERED_F64;
+        } else {
+            needs_order = !strcmp(algorithm_id, "binary") || !strcmp(algorithm_id, "jump") ||
+                          !strcmp(algorithm_id, "exponential") || !strcmp(algorithm_id, "fibonacci");
+        }
+    }
+    if (needs_order && fossil_algorithm_search_type_supported(type_id) &&
+        fossil_algorithm_search_type_sizeof(type_id) != 0 &&
+        !fossil_algorithm_sort_is_sorted(base, count, type_id, order_id))
+        return -6; // input not sorted
+
+    return fossil_algorithm_search_exec(base, count, key, type_id, algorithm_id, order_id);
 }
@@ -58,6 +58,46 @@ static inline void fossil_algorithm_shuffle_swap(void *a, void *b, size_t size)
     }
 }
 
+/**
+ * @brief Per-call generator state (xorshift64*), seeded through splitmix64.
+ *
+ * Lives on the caller's stack instead of the global srand()/rand() state, so
+ * concurrent shuffles do not contend or interfere, and every platform draws
+ * full 32-bit values (MSVC's rand() stops at 32767).
+ */
+typedef struct
+{
+    uint64_t state;
+} fossil_algorithm_shuffle_rng_t;
+
+static inline void fossil_algorithm_shuffle_rng_init(fossil_algorithm_shuffle_rng_t *rng, uint64_t seed)
+{
+    uint64_t z = seed + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    z ^= z >> 31;
+    rng->state = z ? z : 0x9E3779B97F4A7C15ULL;
+}
+
+static inline uint64_t fossil_algorithm_shuffle_rng_next(fossil_algorithm_shuffle_rng_t *rng)
+{
+    uint64_t x = rng->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    rng->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+// Uniform index in [0, bound) via multiply-shift (no division) for 32-bit bounds.
+static inline size_t fossil_algorithm_shuffle_rng_below(fossil_algorithm_shuffle_rng_t *rng, size_t bound)
+{
+    uint64_t r = fossil_algorithm_shuffle_rng_next(rng);
+    if (bound <= 0xFFFFFFFFULL)
+        return (size_t)(((r >> 32) * (uint64_t)bound) >> 32);
+    return (size_t)(r % (uint64_t)bound);
+}
+
 // ======================================================
 // Type Size Resolution
 // ======================================================
@@ -67,21 +107,66 @@ size_t fossil_algorithm_shuffle_type_sizeof(const char *type_id)
     if (!type_id)
         return 0;
 
-    if (strcmp(type_id, "i8") == 0 || strcmp(type_id, "u8") == 0 || strcmp(type_id, "char") == 0 || strcmp(type_id, "bool") == 0)
-        return 1;
-    if (strcmp(type_id, "i16") == 0 || strcmp(type_id, "u16") == 0)
-        return 2;
-    if (strcmp(type_id, "i32") == 0 || strcmp(type_id, "u32") == 0 || strcmp(type_id, "f32") == 0)
-        return 4;
-    if (strcmp(type_id, "i64") == 0 || strcmp(type_id, "u64") == 0 || strcmp(type_id, "f64") == 0 || strcmp(type_id, "size") == 0)
-        return 8;
-    if (strcmp(type_id, "cstr") == 0)
-        return sizeof(char *);
-    if (strcmp(type_id, "hex") == 0 || strcmp(type_id, "oct") == 0 || strcmp(type_id, "bin") == 0 ||
-        strcmp(type_id, "datetime") == 0 || strcmp(type_id, "duration") == 0)
-        return sizeof(uint64_t);
-    if (strcmp(type_id, "any") == 0 || strcmp(type_id, "null") == 0)
-        return sizeof(void *);
+    // Keyed on the first character so small shuffles spend one or two
+    // compares here instead of walking the whole list.
+    switch (type_id[0])
+    {
+    case 'i':
+    case 'u':
+        if (strcmp(type_id + 1, "8") == 0)
+            return 1;
+        if (strcmp(type_id + 1, "16") == 0)
+            return 2;
+        if (strcmp(type_id + 1, "32") == 0)
+            return 4;
+        if (strcmp(type_id + 1, "64") == 0)
+            return 8;
+        break;
+    case 'f':
+        if (strcmp(type_id, "f32") == 0)
+            return 4;
+        if (strcmp(type_id, "f64") == 0)
+            return 8;
+        break;
+    case 'c':
+        if (strcmp(type_id, "char") == 0)
+            return 1;
+        if (strcmp(type_id, "cstr") == 0)
+            return sizeof(char *);
+        break;
+    case 'b':
+        if (strcmp(type_id, "bool") == 0)
+            return 1;
+        if (strcmp(type_id, "bin") == 0)
+            return sizeof(uint64_t);
+        break;
+    case 's':
+        if (strcmp(type_id, "size") == 0)
+            return 8;
+        break;
+    case 'h':
+        if (strcmp(type_id, "hex") == 0)
+            return sizeof(uint64_t);
+        break;
+    case 'o':
+        if (strcmp(type_id, "oct") == 0)
+            return sizeof(uint64_t);
+        break;
+    case 'd':
+        if (strcmp(type_id, "datetime") == 0 || strcmp(type_id, "duration") == 0)
+            return sizeof(uint64_t);
+        break;
+    case 'a':
+        if (strcmp(type_id, "any") == 0)
+            return sizeof(void *);
+        break;
+    case 'n':
+        if (strcmp(type_id, "null") == 0)
+            return sizeof(void *);
+        break;
+    default:
+        break;
+    }
     return 0;
 }
 
@@ -94,26 +179,76 @@ bool fossil_algorithm_shuffle_type_supported(const char *type_id)
 // Shuffle Algorithms
 // ======================================================
 
+// Both algorithms are generated per element width so the swap happens in
+// registers; other widths fall back to the bytewise swap.
+
+#define FOSSIL_SHUFFLE_DEFINE_TYPED(SUFFIX, T) \
+    static void fossil_algorithm_shuffle_fisher_yates_##SUFFIX(T *data, size_t count, fossil_algorithm_shuffle_rng_t *rng) \
+    { \
+        for (size_t i = count - 1; i > 0; --i) \
+        { \
+            size_t j = fossil_algorithm_shuffle_rng_below(rng, i + 1); \
+            T tmp = data[i]; \
+            data[i] = data[j]; \
+            data[j] = tmp; \
+        } \
+    } \
+    static void fossil_algorithm_shuffle_inside_out_##SUFFIX(T *data, size_t count, fossil_algorithm_shuffle_rng_t *rng) \
+    { \
+        for (size_t i = 1; i < count; ++i) \
+        { \
+            size_t j = fossil_algorithm_shuffle_rng_below(rng, i + 1); \
+            T tmp = data[i]; \
+            data[i] = data[j]; \
+            data[j] = tmp; \
+        } \
+    }
+
+FOSSIL_SHUFFLE_DEFINE_TYPED(w8,  uint8_t)
+FOSSIL_SHUFFLE_DEFINE_TYPED(w16, uint16_t)
+FOSSIL_SHUFFLE_DEFINE_TYPED(w32, uint32_t)
+FOSSIL_SHUFFLE_DEFINE_TYPED(w64, uint64_t)
+
 static void fossil_algorithm_shuffle_fisher_yates(void *base, size_t count, size_t size, uint64_t seed)
 {
-    unsigned char *data = (unsigned char *)base;
-    srand((unsigned int)(seed & 0xFFFFFFFFULL));
+    fossil_algorithm_shuffle_rng_t rng;
+    fossil_algorithm_shuffle_rng_init(&rng, seed);
 
+    switch (size)
+    {
+    case 1: fossil_algorithm_shuffle_fisher_yates_w8((uint8_t *)base, count, &rng); return;
+    case 2: fossil_algorithm_shuffle_fisher_yates_w16((uint16_t *)base, count, &rng); return;
+    case 4: fossil_algorithm_shuffle_fisher_yates_w32((uint32_t *)base, count, &rng); return;
+    case 8: fossil_algorithm_shuffle_fisher_yates_w64((uint64_t *)base, count, &rng); return;
+    default: break;
+    }
+
+    unsigned char *data = (unsigned char *)base;
     for (size_t i = count - 1; i > 0; --i)
     {
-        size_t j = (size_t)(rand() % (i + 1));
+        size_t j = fossil_algorithm_shuffle_rng_below(&rng, i + 1);
         fossil_algorithm_shuffle_swap(data + i * size, data + j * size, size);
     }
 }
 
 static void fossil_algorithm_shuffle_inside_out(void *base, size_t count, size_t size, uint64_t seed)
 {
-    unsigned char *data = (unsigned char *)base;
-    srand((unsigned int)(seed & 0xFFFFFFFFULL));
+    fossil_algorithm_shuffle_rng_t rng;
+    fossil_algorithm_shuffle_rng_init(&rng, seed);
 
+    switch (size)
+    {
+    case 1: fossil_algorithm_shuffle_inside_out_w8((uint8_t *)base, count, &rng); return;
+    case 2: fossil_algorithm_shuffle_inside_out_w16((uint16_t *)base, count, &rng); return;
+    case 4: fossil_algorithm_shuffle_inside_out_w32((uint32_t *)base, count, &rng); return;
+    case 8: fossil_algorithm_shuffle_inside_out_w64((uint64_t *)base, count, &rng); return;
+    default: break;
+    }
+
+    unsigned char *data = (unsigned char *)base;
     for (size_t i = 1; i < count; ++i)
     {
-        size_t j = (size_t)(rand() % (i + 1));
+        size_t j = fossil_algorithm_shuffle_rng_below(&rng, i + 1);
         if (j != i)
             fossil_algorithm_shuffle_swap(data + i * size, data + j * size, size);
     }
@@ -139,6 +274,15 @@ int fossil_algorithm_shuffle_exec(
         return -2;
 
     const char *algo = algorithm_id ? algorithm_id : "auto";
+
+    // A single element has nothing to shuffle; skip seeding entirely.
+    if (count == 1)
+    {
+        if (strcmp(algo, "auto") == 0 || strcmp(algo, "fisher-yates") == 0 || strcmp(algo, "inside-out") == 0)
+            return 0;
+        return -3;
+    }
+
     uint64_t final_seed = fossil_algorithm_shuffle_rand_seed(seed, mode_id);
 
     // Algorithm selection
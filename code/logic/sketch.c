@@ -0,0 +1,726 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include "fossil/algorithm/sketch.h"
+#include "fossil/algorithm/sort.h"
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+// ======================================================
+// Local helpers
+// ======================================================
+
+typedef double (*fossil_sketch_load_fn)(const void *base, size_t i);
+
+#define FOSSIL_SKETCH_DEFINE_LOAD(SUFFIX, T) \
+    static double fossil_sketch_load_##SUFFIX(const void *base, size_t i) \
+    { \
+        return (double)((const T *)base)[i]; \
+    }
+
+FOSSIL_SKETCH_DEFINE_LOAD(i8, int8_t)
+FOSSIL_SKETCH_DEFINE_LOAD(i16, int16_t)
+FOSSIL_SKETCH_DEFINE_LOAD(i32, int32_t)
+FOSSIL_SKETCH_DEFINE_LOAD(i64, int64_t)
+FOSSIL_SKETCH_DEFINE_LOAD(u8, uint8_t)
+FOSSIL_SKETCH_DEFINE_LOAD(u16, uint16_t)
+FOSSIL_SKETCH_DEFINE_LOAD(u32, uint32_t)
+FOSSIL_SKETCH_DEFINE_LOAD(u64, uint64_t)
+FOSSIL_SKETCH_DEFINE_LOAD(f32, float)
+FOSSIL_SKETCH_DEFINE_LOAD(f64, double)
+FOSSIL_SKETCH_DEFINE_LOAD(size, size_t)
+
+static fossil_sketch_load_fn fossil_sketch_select_load(const char *type_id) {
+    if (!strcmp(type_id, "i8"))       return fossil_sketch_load_i8;
+    if (!strcmp(type_id, "i16"))      return fossil_sketch_load_i16;
+    if (!strcmp(type_id, "i32"))      return fossil_sketch_load_i32;
+    if (!strcmp(type_id, "i64"))      return fossil_sketch_load_i64;
+
+    if (!strcmp(type_id, "u8"))       return fossil_sketch_load_u8;
+    if (!strcmp(type_id, "u16"))      return fossil_sketch_load_u16;
+    if (!strcmp(type_id, "u32"))      return fossil_sketch_load_u32;
+    if (!strcmp(type_id, "u64"))      return fossil_sketch_load_u64;
+
+    if (!strcmp(type_id, "hex"))      return fossil_sketch_load_u64;
+    if (!strcmp(type_id, "oct"))      return fossil_sketch_load_u64;
+    if (!strcmp(type_id, "bin"))      return fossil_sketch_load_u64;
+
+    if (!strcmp(type_id, "f32"))      return fossil_sketch_load_f32;
+    if (!strcmp(type_id, "f64"))      return fossil_sketch_load_f64;
+
+    if (!strcmp(type_id, "size"))     return fossil_sketch_load_size;
+
+    if (!strcmp(type_id, "datetime")) return fossil_sketch_load_i64;
+    if (!strcmp(type_id, "duration")) return fossil_sketch_load_i64;
+
+    return NULL;
+}
+
+// Sorts a double array with the library's own engines.
+static void fossil_sketch_sort(double *values, size_t count)
+{
+    if (count > 1)
+        fossil_algorithm_sort_exec(values, count, "f64", "auto", "asc");
+}
+
+static int fossil_sketch_grow(double **items, size_t *cap, size_t needed)
+{
+    if (needed <= *cap)
+        return 0;
+    size_t c = *cap ? *cap : 16;
+    while (c < needed) {
+        if (c > ((size_t)-1) / 2 / sizeof(double)) return -4;
+        c *= 2;
+    }
+    double *p = realloc(*items, c * sizeof(double));
+    if (!p) return -4;
+    *items = p;
+    *cap = c;
+    return 0;
+}
+
+// ======================================================
+// Sketch storage
+// ======================================================
+
+#define FOSSIL_SKETCH_KLL_DEFAULT_K   200
+#define FOSSIL_SKETCH_KLL_MIN_WIDTH   8
+#define FOSSIL_SKETCH_TD_DEFAULT      100
+#define FOSSIL_SKETCH_TD_BUFFER_RATIO 5
+#define FOSSIL_SKETCH_PI              3.14159265358979323846
+
+typedef enum {
+    FOSSIL_SKETCH_KLL,
+    FOSSIL_SKETCH_TDIGEST
+} fossil_sketch_method_t;
+
+typedef struct {
+    double *items;
+    size_t size;
+    size_t cap;
+} fossil_kll_level_t;
+
+struct fossil_algorithm_sketch {
+    fossil_sketch_method_t method;
+    fossil_sketch_load_fn load;
+    size_t accuracy;          // k for KLL, delta for t-digest
+    size_t count;
+    double min, max;
+
+    // Exact mode: every value verbatim until EXACT_MAX is exceeded.
+    bool exact;
+    double *exact_items;
+    size_t exact_cap;
+
+    // KLL: level h holds items of weight 2^h.
+    fossil_kll_level_t *levels;
+    size_t level_count;
+    size_t kll_size;          // items over all levels
+    size_t kll_capacity;      // sum of level capacities
+    uint64_t rng;
+
+    // t-digest: sorted centroids plus an unsorted buffer of raw values.
+    double *means, *weights;
+    size_t centroids, centroid_cap;
+    double *scratch_means, *scratch_weights;
+    size_t scratch_cap;
+    double *buffer;
+    size_t buffered, buffer_cap;
+    double td_weight;         // weight held by the centroids
+};
+
+// ======================================================
+// KLL
+// ======================================================
+//
+// Level h > 0 may hold roughly k * (2/3)^(H - 1 - h) items and level 0 up
+// to k. When the sketch is full, the lowest full level is sorted and every other item (random
+// offset) moves up one level with twice the weight; the rest are dropped.
+
+static size_t fossil_kll_level_capacity(size_t k, size_t levels, size_t h)
+{
+    // Level 0 holds weight-1 items, so letting it grow to k costs no
+    // accuracy and saves compacting a handful of items at a time.
+    if (h == 0)
+        return k;
+    double cap = ceil((double)k * pow(2.0 / 3.0, (double)(levels - 1 - h)));
+    return cap < FOSSIL_SKETCH_KLL_MIN_WIDTH ? FOSSIL_SKETCH_KLL_MIN_WIDTH : (size_t)cap;
+}
+
+static void fossil_kll_update_capacity(fossil_algorithm_sketch_t *sk)
+{
+    size_t total = 0;
+    for (size_t h = 0; h < sk->level_count; ++h)
+        total += fossil_kll_level_capacity(sk->accuracy, sk->level_count, h);
+    sk->kll_capacity = total;
+}
+
+static int fossil_kll_add_level(fossil_algorithm_sketch_t *sk)
+{
+    fossil_kll_level_t *levels = realloc(sk->levels, (sk->level_count + 1) * sizeof(*levels));
+    if (!levels) return -4;
+    memset(&levels[sk->level_count], 0, sizeof(*levels));
+    sk->levels = levels;
+    sk->level_count++;
+    fossil_kll_update_capacity(sk);
+    return 0;
+}
+
+static int fossil_kll_push(fossil_algorithm_sketch_t *sk, size_t h, double v)
+{
+    fossil_kll_level_t *lv = &sk->levels[h];
+    if (fossil_sketch_grow(&lv->items, &lv->cap, lv->size + 1) != 0)
+        return -4;
+    lv->items[lv->size++] = v;
+    sk->kll_size++;
+    return 0;
+}
+
+static int fossil_kll_compact(fossil_algorithm_sketch_t *sk)
+{
+    while (sk->kll_size >= sk->kll_capacity) {
+        size_t h = 0;
+        while (h + 1 < sk->level_count &&
+               sk->levels[h].size < fossil_kll_level_capacity(sk->accuracy, sk->level_count, h))
+            ++h;
+        if (h + 1 == sk->level_count && fossil_kll_add_level(sk) != 0)
+            return -4;
+
+        fossil_kll_level_t *lv = &sk->levels[h];
+        fossil_sketch_sort(lv->items, lv->size);
+
+        // xorshift64: one coin flip per compaction.
+        sk->rng ^= sk->rng << 13;
+        sk->rng ^= sk->rng >> 7;
+        sk->rng ^= sk->rng << 17;
+        size_t offset = (size_t)(sk->rng & 1u);
+
+        size_t even = lv->size & ~(size_t)1;
+        size_t up = sk->levels[h + 1].size + even / 2;
+        if (fossil_sketch_grow(&sk->levels[h + 1].items, &sk->levels[h + 1].cap, up) != 0)
+            return -4;
+        lv = &sk->levels[h];
+        fossil_kll_level_t *next = &sk->levels[h + 1];
+        for (size_t i = offset; i < even; i += 2)
+            next->items[next->size++] = lv->items[i];
+
+        // An odd item out stays behind at its current weight.
+        if (lv->size & 1u)
+            lv->items[0] = lv->items[lv->size - 1];
+        sk->kll_size -= lv->size - (lv->size & 1u);
+        sk->kll_size += even / 2;
+        lv->size &= 1u;
+    }
+    return 0;
+}
+
+static int fossil_kll_add(fossil_algorithm_sketch_t *sk, double v)
+{
+    if (sk->level_count == 0 && fossil_kll_add_level(sk) != 0)
+        return -4;
+    if (fossil_kll_push(sk, 0, v) != 0)
+        return -4;
+    return sk->kll_size >= sk->kll_capacity ? fossil_kll_compact(sk) : 0;
+}
+
+static int fossil_kll_merge(fossil_algorithm_sketch_t *sk, const fossil_algorithm_sketch_t *other)
+{
+    while (sk->level_count < other->level_count)
+        if (fossil_kll_add_level(sk) != 0)
+            return -4;
+    for (size_t h = 0; h < other->level_count; ++h) {
+        const fossil_kll_level_t *src = &other->levels[h];
+        fossil_kll_level_t *dst = &sk->levels[h];
+        if (fossil_sketch_grow(&dst->items, &dst->cap, dst->size + src->size) != 0)
+            return -4;
+        if (src->size)
+            memcpy(dst->items + dst->size, src->items, src->size * sizeof(double));
+        dst->size += src->size;
+        sk->kll_size += src->size;
+    }
+    return fossil_kll_compact(sk);
+}
+
+// Flattens the levels into ascending values with cumulative weights.
+static int fossil_kll_flatten(fossil_algorithm_sketch_t *sk, double **values, double **cumulative, size_t *n)
+{
+    size_t total = sk->kll_size;
+    double *v = malloc((total ? total : 1) * sizeof(double));
+    double *c = malloc((total ? total : 1) * sizeof(double));
+    size_t *pos = calloc(sk->level_count ? sk->level_count : 1, sizeof(size_t));
+    if (!v || !c || !pos) {
+        free(v);
+        free(c);
+        free(pos);
+        return -4;
+    }
+
+    for (size_t h = 0; h < sk->level_count; ++h)
+        fossil_sketch_sort(sk->levels[h].items, sk->levels[h].size);
+
+    double acc = 0.0;
+    for (size_t i = 0; i < total; ++i) {
+        size_t best = sk->level_count;
+        for (size_t h = 0; h < sk->level_count; ++h) {
+            if (pos[h] < sk->levels[h].size &&
+                (best == sk->level_count || sk->levels[h].items[pos[h]] < sk->levels[best].items[pos[best]]))
+                best = h;
+        }
+        v[i] = sk->levels[best].items[pos[best]++];
+        acc += ldexp(1.0, (int)best);
+        c[i] = acc;
+    }
+    free(pos);
+    *values = v;
+    *cumulative = c;
+    *n = total;
+    return 0;
+}
+
+// ======================================================
+// t-digest
+// ======================================================
+//
+// Merging t-digest with the k1 scale function
+// k(q) = delta / (2 pi) * asin(2q - 1). A centroid may absorb neighbours
+// while it spans at most one unit of k, so centroids stay small near the
+// tails and large around the median.
+
+static double fossil_td_q_limit(double delta, double q)
+{
+    double k = delta / (2.0 * FOSSIL_SKETCH_PI) * asin(2.0 * q - 1.0) + 1.0;
+    if (k >= delta / 4.0)
+        return 1.0;
+    return (sin(k * 2.0 * FOSSIL_SKETCH_PI / delta) + 1.0) / 2.0;
+}
+
+// Merges the sorted run (means, weights; NULL weights mean 1) with the
+// current centroids and recompresses.
+static int fossil_td_fold(fossil_algorithm_sketch_t *sk, const double *means, const double *weights, size_t n)
+{
+    if (n == 0)
+        return 0;
+
+    size_t need = sk->centroids + n;
+    if (need > sk->scratch_cap) {
+        double *m = realloc(sk->scratch_means, need * sizeof(double));
+        if (!m) return -4;
+        sk->scratch_means = m;
+        double *w = realloc(sk->scratch_weights, need * sizeof(double));
+        if (!w) return -4;
+        sk->scratch_weights = w;
+        sk->scratch_cap = need;
+    }
+
+    double total = sk->td_weight;
+    for (size_t i = 0; i < n; ++i)
+        total += weights ? weights[i] : 1.0;
+
+    double delta = (double)sk->accuracy;
+    size_t a = 0, b = 0, out = 0;
+    double so_far = 0.0;
+    double limit = total * fossil_td_q_limit(delta, 0.0);
+    double cur_m = 0.0, cur_w = 0.0;
+
+    while (a < sk->centroids || b < n) {
+        double m, w;
+        if (b >= n || (a < sk->centroids && sk->means[a] <= means[b])) {
+            m = sk->means[a];
+            w = sk->weights[a++];
+        } else {
+            m = means[b];
+            w = weights ? weights[b] : 1.0;
+            ++b;
+        }
+
+        if (cur_w > 0.0 && so_far + cur_w + w <= limit) {
+            cur_w += w;
+            cur_m += (m - cur_m) * w / cur_w;
+            continue;
+        }
+        if (cur_w > 0.0) {
+            sk->scratch_means[out] = cur_m;
+            sk->scratch_weights[out++] = cur_w;
+            so_far += cur_w;
+            limit = total * fossil_td_q_limit(delta, so_far / total);
+        }
+        cur_m = m;
+        cur_w = w;
+    }
+    sk->scratch_means[out] = cur_m;
+    sk->scratch_weights[out++] = cur_w;
+
+    double *swap = sk->means;
+    sk->means = sk->scratch_means;
+    sk->scratch_means = swap;
+    swap = sk->weights;
+    sk->weights = sk->scratch_weights;
+    sk->scratch_weights = swap;
+    size_t cap = sk->centroid_cap;
+    sk->centroid_cap = sk->scratch_cap;
+    sk->scratch_cap = cap;
+
+    sk->centroids = out;
+    sk->td_weight = total;
+    return 0;
+}
+
+static int fossil_td_flush(fossil_algorithm_sketch_t *sk)
+{
+    if (sk->buffered == 0)
+        return 0;
+    fossil_sketch_sort(sk->buffer, sk->buffered);
+    int status = fossil_td_fold(sk, sk->buffer, NULL, sk->buffered);
+    if (status == 0)
+        sk->buffered = 0;
+    return status;
+}
+
+static int fossil_td_add(fossil_algorithm_sketch_t *sk, double v)
+{
+    if (sk->buffered == sk->buffer_cap) {
+        size_t cap = sk->accuracy * FOSSIL_SKETCH_TD_BUFFER_RATIO;
+        if (sk->buffer_cap == 0) {
+            sk->buffer = malloc(cap * sizeof(double));
+            if (!sk->buffer) return -4;
+            sk->buffer_cap = cap;
+        } else if (fossil_td_flush(sk) != 0) {
+            return -4;
+        }
+    }
+    sk->buffer[sk->buffered++] = v;
+    return 0;
+}
+
+static double fossil_td_quantile(const fossil_algorithm_sketch_t *sk, double q)
+{
+    if (sk->centroids == 1)
+        return sk->means[0];
+
+    // Centroid i is centred at weight cum_i + w_i / 2; interpolate between
+    // neighbouring centres and towards min / max at the ends.
+    double index = q * sk->td_weight;
+    double first = sk->weights[0] / 2.0;
+    if (index < first)
+        return sk->min + (sk->means[0] - sk->min) * (index / first);
+
+    double cum = 0.0;
+    for (size_t i = 0; i + 1 < sk->centroids; ++i) {
+        double lo = cum + sk->weights[i] / 2.0;
+        double hi = cum + sk->weights[i] + sk->weights[i + 1] / 2.0;
+        if (index <= hi) {
+            double t = (index - lo) / (hi - lo);
+            return sk->means[i] + (sk->means[i + 1] - sk->means[i]) * t;
+        }
+        cum += sk->weights[i];
+    }
+
+    size_t last = sk->centroids - 1;
+    double lo = sk->td_weight - sk->weights[last] / 2.0;
+    double span = sk->td_weight - lo;
+    double t = span > 0.0 ? (index - lo) / span : 1.0;
+    return sk->means[last] + (sk->max - sk->means[last]) * (t > 1.0 ? 1.0 : t);
+}
+
+// ======================================================
+// Exact mode
+// ======================================================
+
+static int fossil_sketch_method_add(fossil_algorithm_sketch_t *sk, double v)
+{
+    return sk->method == FOSSIL_SKETCH_KLL ? fossil_kll_add(sk, v) : fossil_td_add(sk, v);
+}
+
+// Replays the verbatim values into the approximate structure.
+static int fossil_sketch_leave_exact(fossil_algorithm_sketch_t *sk)
+{
+    if (!sk->exact)
+        return 0;
+    sk->exact = false;
+    size_t held = sk->count;
+    for (size_t i = 0; i < held; ++i)
+        if (fossil_sketch_method_add(sk, sk->exact_items[i]) != 0)
+            return -4;
+    free(sk->exact_items);
+    sk->exact_items = NULL;
+    sk->exact_cap = 0;
+    return 0;
+}
+
+static int fossil_sketch_push(fossil_algorithm_sketch_t *sk, double v)
+{
+    if (isnan(v))
+        return 0;
+
+    if (sk->exact && sk->count == FOSSIL_ALGORITHM_SKETCH_EXACT_MAX && fossil_sketch_leave_exact(sk) != 0)
+        return -4;
+
+    if (sk->exact) {
+        if (fossil_sketch_grow(&sk->exact_items, &sk->exact_cap, sk->count + 1) != 0)
+            return -4;
+        sk->exact_items[sk->count] = v;
+    } else if (fossil_sketch_method_add(sk, v) != 0) {
+        return -4;
+    }
+
+    if (sk->count == 0 || v < sk->min) sk->min = v;
+    if (sk->count == 0 || v > sk->max) sk->max = v;
+    sk->count++;
+    return 0;
+}
+
+// ======================================================
+// Public API
+// ======================================================
+
+fossil_algorithm_sketch_t *fossil_algorithm_sketch_create(
+    const char *type_id,
+    const char *method_id,
+    size_t accuracy)
+{
+    if (!type_id || !method_id)
+        return NULL;
+
+    fossil_sketch_load_fn load = fossil_sketch_select_load(type_id);
+    if (!load)
+        return NULL;
+
+    fossil_sketch_method_t method;
+    if (!strcmp(method_id, "kll"))
+        method = FOSSIL_SKETCH_KLL;
+    else if (!strcmp(method_id, "tdigest"))
+        method = FOSSIL_SKETCH_TDIGEST;
+    else
+        return NULL;
+
+    fossil_algorithm_sketch_t *sk = calloc(1, sizeof(*sk));
+    if (!sk)
+        return NULL;
+
+    sk->method = method;
+    sk->load = load;
+    if (accuracy == 0)
+        accuracy = method == FOSSIL_SKETCH_KLL ? FOSSIL_SKETCH_KLL_DEFAULT_K : FOSSIL_SKETCH_TD_DEFAULT;
+    if (accuracy < FOSSIL_SKETCH_KLL_MIN_WIDTH)
+        accuracy = FOSSIL_SKETCH_KLL_MIN_WIDTH;
+    sk->accuracy = accuracy;
+    sk->exact = true;
+    sk->rng = 0x9E3779B97F4A7C15ULL;
+    return sk;
+}
+
+void fossil_algorithm_sketch_destroy(fossil_algorithm_sketch_t *sk)
+{
+    if (!sk)
+        return;
+    fossil_algorithm_sketch_clear(sk);
+    free(sk->levels);
+    free(sk->means);
+    free(sk->weights);
+    free(sk->scratch_means);
+    free(sk->scratch_weights);
+    free(sk->buffer);
+    free(sk);
+}
+
+int fossil_algorithm_sketch_add(fossil_algorithm_sketch_t *sk, const void *elem)
+{
+    if (!sk || !elem)
+        return -1;
+    return fossil_sketch_push(sk, sk->load(elem, 0));
+}
+
+int fossil_algorithm_sketch_add_many(fossil_algorithm_sketch_t *sk, const void *elems, size_t count)
+{
+    if (!sk || (!elems && count > 0))
+        return -1;
+    for (size_t i = 0; i < count; ++i)
+        if (fossil_sketch_push(sk, sk->load(elems, i)) != 0)
+            return -4;
+    return 0;
+}
+
+int fossil_algorithm_sketch_merge(fossil_algorithm_sketch_t *sk, const fossil_algorithm_sketch_t *other)
+{
+    if (!sk || !other || sk == other)
+        return -1;
+    if (sk->method != other->method || sk->accuracy != other->accuracy)
+        return -3;
+    if (other->count == 0)
+        return 0;
+
+    size_t count = sk->count + other->count;
+    double min = (sk->count == 0 || other->min < sk->min) ? other->min : sk->min;
+    double max = (sk->count == 0 || other->max > sk->max) ? other->max : sk->max;
+
+    if (other->exact) {
+        // Raw values go through the normal path, which also leaves exact
+        // mode once the combined count outgrows it.
+        for (size_t i = 0; i < other->count; ++i)
+            if (fossil_sketch_push(sk, other->exact_items[i]) != 0)
+                return -4;
+        return 0;
+    }
+
+    if (fossil_sketch_leave_exact(sk) != 0)
+        return -4;
+
+    int status;
+    if (sk->method == FOSSIL_SKETCH_KLL) {
+        status = fossil_kll_merge(sk, other);
+    } else {
+        status = fossil_td_fold(sk, other->means, other->weights, other->centroids);
+        for (size_t i = 0; status == 0 && i < other->buffered; ++i)
+            status = fossil_td_add(sk, other->buffer[i]);
+    }
+    if (status != 0)
+        return -4;
+
+    sk->count = count;
+    sk->min = min;
+    sk->max = max;
+    return 0;
+}
+
+int fossil_algorithm_sketch_quantiles(
+    fossil_algorithm_sketch_t *sk,
+    const double *qs,
+    size_t count,
+    double *out)
+{
+    if (!sk || (count > 0 && (!qs || !out)))
+        return -1;
+    for (size_t i = 0; i < count; ++i)
+        if (!(qs[i] >= 0.0 && qs[i] <= 1.0))
+            return -1;
+    if (sk->count == 0)
+        return -2;
+
+    if (sk->exact) {
+        fossil_sketch_sort(sk->exact_items, sk->count);
+        for (size_t i = 0; i < count; ++i) {
+            double rank = ceil(qs[i] * (double)sk->count);
+            size_t idx = rank < 1.0 ? 0 : (size_t)rank - 1;
+            out[i] = sk->exact_items[idx < sk->count ? idx : sk->count - 1];
+        }
+        return 0;
+    }
+
+    if (sk->method == FOSSIL_SKETCH_TDIGEST) {
+        if (fossil_td_flush(sk) != 0)
+            return -4;
+        for (size_t i = 0; i < count; ++i) {
+            double v = fossil_td_quantile(sk, qs[i]);
+            out[i] = v < sk->min ? sk->min : (v > sk->max ? sk->max : v);
+        }
+    } else {
+        double *values, *cumulative;
+        size_t n;
+        if (fossil_kll_flatten(sk, &values, &cumulative, &n) != 0)
+            return -4;
+        double total = cumulative[n - 1];
+        for (size_t i = 0; i < count; ++i) {
+            // First item whose cumulative weight reaches q * total.
+            double target = qs[i] * total;
+            size_t lo = 0, hi = n - 1;
+            while (lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if (cumulative[mid] < target)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+            out[i] = values[lo];
+        }
+        free(values);
+        free(cumulative);
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (qs[i] == 0.0) out[i] = sk->min;
+        if (qs[i] == 1.0) out[i] = sk->max;
+    }
+    return 0;
+}
+
+int fossil_algorithm_sketch_quantile(fossil_algorithm_sketch_t *sk, double q, double *out)
+{
+    return fossil_algorithm_sketch_quantiles(sk, &q, 1, out);
+}
+
+size_t fossil_algorithm_sketch_count(const fossil_algorithm_sketch_t *sk)
+{
+    return sk ? sk->count : 0;
+}
+
+bool fossil_algorithm_sketch_is_exact(const fossil_algorithm_sketch_t *sk)
+{
+    return sk ? sk->exact : false;
+}
+
+void fossil_algorithm_sketch_clear(fossil_algorithm_sketch_t *sk)
+{
+    if (!sk)
+        return;
+    for (size_t h = 0; h < sk->level_count; ++h)
+        free(sk->levels[h].items);
+    sk->level_count = 0;
+    sk->kll_size = 0;
+    sk->kll_capacity = 0;
+    free(sk->exact_items);
+    sk->exact_items = NULL;
+    sk->exact_cap = 0;
+    sk->centroids = 0;
+    sk->buffered = 0;
+    sk->td_weight = 0.0;
+    sk->count = 0;
+    sk->exact = true;
+}
+
+int fossil_algorithm_sketch_exec(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *method_id,
+    const double *qs,
+    size_t q_count,
+    double *out)
+{
+    if (!type_id || !method_id || (count > 0 && !base) || (q_count > 0 && (!qs || !out)))
+        return -1;
+
+    if (!fossil_sketch_select_load(type_id) || (strcmp(method_id, "kll") && strcmp(method_id, "tdigest")))
+        return -3;
+
+    fossil_algorithm_sketch_t *sk = fossil_algorithm_sketch_create(type_id, method_id, 0);
+    if (!sk)
+        return -4;
+
+    int status = fossil_algorithm_sketch_add_many(sk, base, count);
+    if (status == 0)
+        status = fossil_algorithm_sketch_quantiles(sk, qs, q_count, out);
+    fossil_algorithm_sketch_destroy(sk);
+    return status;
+}
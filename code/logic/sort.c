@@ -27,6 +27,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stddef.h>
+#include <math.h>
+#include "thread.h"
 
 // ======================================================
 // Supported Identifiers
@@ -56,16 +58,18 @@
  * | Algorithm | Description |
  * |------------|----------------------------|
  * | "auto"     | Automatically selects the best algorithm |
+ * | "quick"    | Introsort with three-way partitioning    |
  * | "merge"    | Stable merge sort                        |
- * | "heap"     | Heap sort (memory-efficient)              |
+ * | "heap"     | 4-ary bottom-up heap sort (O(1) memory)   |
  * | "insertion"| Simple insertion sort (small arrays)      |
- * | "shell"    | Shell sort (incremental gap sort)         |
- * | "radix"    | Radix sort (integer keys only)            |
- * | "counting" | Counting sort (integer range keys only)   |
+ * | "shell"    | Shell sort (Ciura gaps, no extra memory)  |
+ * | "radix"    | LSD byte radix sort (integer keys only)   |
+ * | "counting" | Counting sort (keys spanning <= 65536)    |
+ * | "flash"    | Flash sort along a sampled distribution   |
  * | "bubble"   | Bubble sort (testing/educational only)    |
  */
 #define FOSSIL_SORT_SUPPORTED_ALGO_IDS \
-    "auto, merge, heap, insertion, shell, radix, counting, bubble"
+    "auto, quick, merge, heap, insertion, shell, radix, counting, flash, bubble"
 
 /**
  * @brief Supported order identifiers for @ref fossil_algorithm_sort_exec.
@@ -280,6 +284,679 @@ static fossil_sort_compare_fn fossil_sort_select_comparator(const char *type_id)
     return NULL;
 }
 
+// ======================================================
+// Typed kernels
+// ======================================================
+
+/**
+ * @brief Element layouts that have a dedicated typed kernel.
+ *
+ * Type identifiers that share a representation share a kind: "hex", "oct"
+ * and "bin" are u64, "datetime" and "duration" are i64, "bool" is u8 and
+ * "size" maps to the unsigned kind matching size_t. "cstr" has no typed
+ * kernel and always goes through the comparator.
+ */
+typedef enum {
+    FOSSIL_SORT_KIND_NONE = 0,
+    FOSSIL_SORT_KIND_I8,
+    FOSSIL_SORT_KIND_I16,
+    FOSSIL_SORT_KIND_I32,
+    FOSSIL_SORT_KIND_I64,
+    FOSSIL_SORT_KIND_U8,
+    FOSSIL_SORT_KIND_U16,
+    FOSSIL_SORT_KIND_U32,
+    FOSSIL_SORT_KIND_U64,
+    FOSSIL_SORT_KIND_F32,
+    FOSSIL_SORT_KIND_F64,
+    FOSSIL_SORT_KIND_CHAR
+} fossil_sort_kind_t;
+
+/**
+ * @brief X-macro over every typed kind: X(NAME, suffix, C type).
+ */
+#define FOSSIL_SORT_FOREACH_KIND(X) \
+    X(I8,   i8,   int8_t)   \
+    X(I16,  i16,  int16_t)  \
+    X(I32,  i32,  int32_t)  \
+    X(I64,  i64,  int64_t)  \
+    X(U8,   u8,   uint8_t)  \
+    X(U16,  u16,  uint16_t) \
+    X(U32,  u32,  uint32_t) \
+    X(U64,  u64,  uint64_t) \
+    X(F32,  f32,  float)    \
+    X(F64,  f64,  double)   \
+    X(CHAR, char, char)
+
+/**
+ * @brief Largest element handled by the generic (comparator) kernels.
+ *
+ * Every supported type_id fits, so generic kernels keep their temporaries on
+ * the stack instead of calling malloc.
+ */
+#define FOSSIL_SORT_ELEM_MAX 16
+
+typedef union {
+    unsigned char bytes[FOSSIL_SORT_ELEM_MAX];
+    uint64_t u64;
+    double f64;
+    void *ptr;
+} fossil_sort_elem_t;
+
+// Resolves a type identifier to its kernel kind. Switching on the first
+// character keeps this to one or two short compares, which matters on the
+// small-input path where resolution is a visible share of the call.
+static fossil_sort_kind_t fossil_sort_select_kind(const char *type_id) {
+    switch (type_id[0]) {
+    case 'i':
+        if (!strcmp(type_id, "i8"))       return FOSSIL_SORT_KIND_I8;
+        if (!strcmp(type_id, "i16"))      return FOSSIL_SORT_KIND_I16;
+        if (!strcmp(type_id, "i32"))      return FOSSIL_SORT_KIND_I32;
+        if (!strcmp(type_id, "i64"))      return FOSSIL_SORT_KIND_I64;
+        break;
+    case 'u':
+        if (!strcmp(type_id, "u8"))       return FOSSIL_SORT_KIND_U8;
+        if (!strcmp(type_id, "u16"))      return FOSSIL_SORT_KIND_U16;
+        if (!strcmp(type_id, "u32"))      return FOSSIL_SORT_KIND_U32;
+        if (!strcmp(type_id, "u64"))      return FOSSIL_SORT_KIND_U64;
+        break;
+    case 'f':
+        if (!strcmp(type_id, "f32"))      return FOSSIL_SORT_KIND_F32;
+        if (!strcmp(type_id, "f64"))      return FOSSIL_SORT_KIND_F64;
+        break;
+    case 'h':
+        if (!strcmp(type_id, "hex"))      return FOSSIL_SORT_KIND_U64;
+        break;
+    case 'o':
+        if (!strcmp(type_id, "oct"))      return FOSSIL_SORT_KIND_U64;
+        break;
+    case 'b':
+        if (!strcmp(type_id, "bin"))      return FOSSIL_SORT_KIND_U64;
+        if (!strcmp(type_id, "bool"))     return sizeof(bool) == 1 ? FOSSIL_SORT_KIND_U8 : FOSSIL_SORT_KIND_NONE;
+        break;
+    case 'c':
+        if (!strcmp(type_id, "char"))     return FOSSIL_SORT_KIND_CHAR;
+        break;
+    case 's':
+        if (!strcmp(type_id, "size"))     return sizeof(size_t) == 8 ? FOSSIL_SORT_KIND_U64 : FOSSIL_SORT_KIND_U32;
+        break;
+    case 'd':
+        if (!strcmp(type_id, "datetime")) return FOSSIL_SORT_KIND_I64;
+        if (!strcmp(type_id, "duration")) return FOSSIL_SORT_KIND_I64;
+        break;
+    default:
+        break;
+    }
+    return FOSSIL_SORT_KIND_NONE;
+}
+
+static size_t fossil_sort_kind_sizeof(fossil_sort_kind_t kind) {
+    switch (kind) {
+#define FOSSIL_SORT_CASE_SIZEOF(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return sizeof(T);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_SIZEOF)
+#undef FOSSIL_SORT_CASE_SIZEOF
+    default:
+        return 0;
+    }
+}
+
+// Insertion sort: stable, allocation-free, and the finishing pass for small
+// runs in the other engines.
+
+#define FOSSIL_SORT_DEFINE_INSERTION(NAME, SUFFIX, T) \
+    static void fossil_insertion_sort_##SUFFIX(T *a, size_t n, bool desc) \
+    { \
+        for (size_t i = 1; i < n; ++i) { \
+            T x = a[i]; \
+            size_t j = i; \
+            while (j > 0 && (desc ? a[j - 1] < x : a[j - 1] > x)) { \
+                a[j] = a[j - 1]; \
+                --j; \
+            } \
+            a[j] = x; \
+        } \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_INSERTION)
+
+static bool fossil_sort_insertion_kind(void *base, size_t count, fossil_sort_kind_t kind, bool desc)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_INSERTION(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: fossil_insertion_sort_##SUFFIX((T *)base, count, desc); return true;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_INSERTION)
+#undef FOSSIL_SORT_CASE_INSERTION
+    default:
+        return false;
+    }
+}
+
+static void fossil_insertion_sort_generic(
+    char *arr, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    fossil_sort_elem_t tmp;
+    for (size_t i = 1; i < count; ++i) {
+        memcpy(tmp.bytes, arr + i * type_size, type_size);
+        size_t j = i;
+        while (j > 0 && cmp(arr + (j - 1) * type_size, tmp.bytes, desc) > 0) {
+            memcpy(arr + j * type_size, arr + (j - 1) * type_size, type_size);
+            --j;
+        }
+        memcpy(arr + j * type_size, tmp.bytes, type_size);
+    }
+}
+
+// ======================================================
+// Sorting networks
+// ======================================================
+
+// Batcher odd-even merge networks for 2..32 elements, pruned to the exact
+// size. Pairs for size n live at [offset[n], offset[n + 1]) and every pair
+// (i, j) with i < j is a compare-exchange that leaves the smaller value at i.
+
+static const uint16_t fossil_network_offset[] = {
+    0, 0, 0, 1, 4, 9, 18, 30, 46, 65, 93, 125,
+    163, 205, 253, 306, 365, 428, 513, 603, 701, 804, 916, 1035,
+    1162, 1294, 1434, 1581, 1737, 1899, 2070, 2248, 2434, 2625
+};
+
+static const uint8_t fossil_network_pairs[] = {
+    /*  2 */ 0, 1,
+    /*  3 */ 0, 1, 0, 2, 1, 2,
+    /*  4 */ 0, 1, 2, 3, 0, 2, 1, 3, 1, 2,
+    /*  5 */ 0, 1, 2, 3, 0, 2, 1, 3, 1, 2, 0, 4, 2, 4, 1, 2, 3, 4,
+    /*  6 */ 0, 1, 2, 3, 4, 5, 0, 2, 1, 3, 1, 2, 0, 4, 1, 5, 2, 4, 3, 5, 1, 2, 3, 4,
+    /*  7 */ 0, 1, 2, 3, 4, 5, 0, 2, 1, 3, 4, 6, 1, 2, 5, 6, 0, 4, 1, 5, 2, 6, 2, 4,
+             3, 5, 1, 2, 3, 4, 5, 6,
+    /*  8 */ 0, 1, 2, 3, 4, 5, 6, 7, 0, 2, 1, 3, 4, 6, 5, 7, 1, 2, 5, 6, 0, 4, 1, 5,
+             2, 6, 3, 7, 2, 4, 3, 5, 1, 2, 3, 4, 5, 6,
+    /*  9 */ 0, 1, 2, 3, 4, 5, 6, 7, 0, 2, 1, 3, 4, 6, 5, 7, 1, 2, 5, 6, 0, 4, 1, 5,
+             2, 6, 3, 7, 2, 4, 3, 5, 1, 2, 3, 4, 5, 6, 0, 8, 4, 8, 2, 4, 3, 5, 6, 8,
+             1, 2, 3, 4, 5, 6, 7, 8,
+    /* 10 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 2, 1, 3, 4, 6, 5, 7, 1, 2, 5, 6, 0, 4,
+             1, 5, 2, 6, 3, 7, 2, 4, 3, 5, 1, 2, 3, 4, 5, 6, 0, 8, 1, 9, 4, 8, 5, 9,
+             2, 4, 3, 5, 6, 8, 7, 9, 1, 2, 3, 4, 5, 6, 7, 8,
+    /* 11 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 1, 2, 5, 6,
+             9, 10, 0, 4, 1, 5, 2, 6, 3, 7, 2, 4, 3, 5, 1, 2, 3, 4, 5, 6, 9, 10, 0, 8,
+             1, 9, 2, 10, 4, 8, 5, 9, 6, 10, 2, 4, 3, 5, 6, 8, 7, 9, 1, 2, 3, 4, 5, 6,
+             7, 8, 9, 10,
+    /* 12 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11,
+             1, 2, 5, 6, 9, 10, 0, 4, 1, 5, 2, 6, 3, 7, 2, 4, 3, 5, 1, 2, 3, 4, 5, 6,
+             9, 10, 0, 8, 1, 9, 2, 10, 3, 11, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8,
+             7, 9, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    /* 13 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11,
+             1, 2, 5, 6, 9, 10, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 2, 4, 3, 5, 10, 12, 1, 2,
+             3, 4, 5, 6, 9, 10, 11, 12, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 4, 8, 5, 9, 6, 10,
+             7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    /* 14 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10,
+             9, 11, 1, 2, 5, 6, 9, 10, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 2, 4, 3, 5,
+             10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12,
+             5, 13, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 1, 2,
+             3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+    /* 15 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10,
+             9, 11, 12, 14, 1, 2, 5, 6, 9, 10, 13, 14, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13,
+             10, 14, 2, 4, 3, 5, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 0, 8,
+             1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5,
+             6, 8, 7, 9, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+    /* 16 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 2, 1, 3, 4, 6, 5, 7,
+             8, 10, 9, 11, 12, 14, 13, 15, 1, 2, 5, 6, 9, 10, 13, 14, 0, 4, 1, 5, 2, 6, 3, 7,
+             8, 12, 9, 13, 10, 14, 11, 15, 2, 4, 3, 5, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 9, 10,
+             11, 12, 13, 14, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9,
+             6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14,
+    /* 17 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 2, 1, 3, 4, 6, 5, 7,
+             8, 10, 9, 11, 12, 14, 13, 15, 1, 2, 5, 6, 9, 10, 13, 14, 0, 4, 1, 5, 2, 6, 3, 7,
+             8, 12, 9, 13, 10, 14, 11, 15, 2, 4, 3, 5, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 9, 10,
+             11, 12, 13, 14, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9,
+             6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 0, 16, 8, 16, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 2, 4, 3, 5,
+             6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+             15, 16,
+    /* 18 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 2, 1, 3, 4, 6,
+             5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 1, 2, 5, 6, 9, 10, 13, 14, 0, 4, 1, 5, 2, 6,
+             3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 2, 4, 3, 5, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6,
+             9, 10, 11, 12, 13, 14, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8,
+             5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 1, 2, 3, 4, 5, 6,
+             7, 8, 9, 10, 11, 12, 13, 14, 0, 16, 1, 17, 8, 16, 9, 17, 4, 8, 5, 9, 6, 10, 7, 11,
+             12, 16, 13, 17, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 1, 2, 3, 4,
+             5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    /* 19 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 2, 1, 3, 4, 6,
+             5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 0, 4,
+             1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 2, 4, 3, 5, 10, 12, 11, 13, 1, 2,
+             3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13,
+             6, 14, 7, 15, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13,
+             1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 0, 16, 1, 17, 2, 18, 8, 16,
+             9, 17, 10, 18, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 2, 4, 3, 5, 6, 8,
+             7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+             15, 16, 17, 18,
+    /* 20 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 2, 1, 3,
+             4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 1, 2, 5, 6, 9, 10, 13, 14,
+             17, 18, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 2, 4, 3, 5, 10, 12,
+             11, 13, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 0, 8, 1, 9, 2, 10, 3, 11,
+             4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9,
+             10, 12, 11, 13, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 0, 16, 1, 17,
+             2, 18, 3, 19, 8, 16, 9, 17, 10, 18, 11, 19, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17,
+             14, 18, 15, 19, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 1, 2, 3, 4,
+             5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    /* 21 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 2, 1, 3,
+             4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 1, 2, 5, 6, 9, 10, 13, 14,
+             17, 18, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 2, 4, 3, 5,
+             10, 12, 11, 13, 18, 20, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 0, 8,
+             1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4,
+             3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+             13, 14, 17, 18, 19, 20, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 8, 16, 9, 17, 10, 18, 11, 19,
+             12, 20, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 2, 4, 3, 5, 6, 8,
+             7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+             13, 14, 15, 16, 17, 18, 19, 20,
+    /* 22 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 0, 2,
+             1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 1, 2, 5, 6, 9, 10,
+             13, 14, 17, 18, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21,
+             2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14,
+             17, 18, 19, 20, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9,
+             6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 1, 2, 3, 4,
+             5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20,
+             5, 21, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16,
+             13, 17, 14, 18, 15, 19, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20,
+             19, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    /* 23 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 0, 2,
+             1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 20, 22, 1, 2, 5, 6,
+             9, 10, 13, 14, 17, 18, 21, 22, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15,
+             16, 20, 17, 21, 18, 22, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6,
+             9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13,
+             6, 14, 7, 15, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13,
+             18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22,
+             0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20,
+             13, 21, 14, 22, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 2, 4, 3, 5,
+             6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    /* 24 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 20, 22, 21, 23,
+             1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13,
+             10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21,
+             1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 0, 8, 1, 9, 2, 10,
+             3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 4, 8, 5, 9, 6, 10, 7, 11, 2, 4, 3, 5, 6, 8,
+             7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+             17, 18, 19, 20, 21, 22, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 16,
+             9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16,
+             13, 17, 14, 18, 15, 19, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20,
+             19, 21, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    /* 25 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 20, 22, 21, 23,
+             1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13,
+             10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21,
+             1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 0, 8, 1, 9, 2, 10,
+             3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24, 4, 8, 5, 9, 6, 10, 7, 11, 20, 24, 2, 4,
+             3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 22, 24, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20,
+             5, 21, 6, 22, 7, 23, 8, 24, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23,
+             4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 20, 24, 2, 4, 3, 5, 6, 8,
+             7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 19, 21, 22, 24, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+    /* 26 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 20, 22,
+             21, 23, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12,
+             9, 13, 10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20,
+             19, 21, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 0, 8, 1, 9,
+             2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24, 17, 25, 4, 8, 5, 9, 6, 10, 7, 11,
+             20, 24, 21, 25, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 22, 24, 23, 25,
+             1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 0, 16,
+             1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 24, 9, 25, 8, 16, 9, 17, 10, 18,
+             11, 19, 12, 20, 13, 21, 14, 22, 15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18,
+             15, 19, 20, 24, 21, 25, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20,
+             19, 21, 22, 24, 23, 25, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 23, 24,
+    /* 27 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19, 20, 22,
+             21, 23, 24, 26, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26, 0, 4, 1, 5, 2, 6,
+             3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 2, 4, 3, 5, 10, 12,
+             11, 13, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22,
+             25, 26, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24, 17, 25, 18, 26,
+             4, 8, 5, 9, 6, 10, 7, 11, 20, 24, 21, 25, 22, 26, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12,
+             11, 13, 18, 20, 19, 21, 22, 24, 23, 25, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+             17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22,
+             7, 23, 8, 24, 9, 25, 10, 26, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23,
+             4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 20, 24, 21, 25, 22, 26, 2, 4,
+             3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 19, 21, 22, 24, 23, 25, 1, 2,
+             3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    /* 28 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 26, 27, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19,
+             20, 22, 21, 23, 24, 26, 25, 27, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26, 0, 4,
+             1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 2, 4,
+             3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18,
+             19, 20, 21, 22, 25, 26, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24,
+             17, 25, 18, 26, 19, 27, 4, 8, 5, 9, 6, 10, 7, 11, 20, 24, 21, 25, 22, 26, 23, 27, 2, 4,
+             3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 22, 24, 23, 25, 1, 2, 3, 4, 5, 6,
+             7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 16, 1, 17, 2, 18,
+             3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 24, 9, 25, 10, 26, 11, 27, 8, 16, 9, 17, 10, 18,
+             11, 19, 12, 20, 13, 21, 14, 22, 15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18,
+             15, 19, 20, 24, 21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16,
+             15, 17, 18, 20, 19, 21, 22, 24, 23, 25, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+             15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    /* 29 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 26, 27, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18, 17, 19,
+             20, 22, 21, 23, 24, 26, 25, 27, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26, 0, 4,
+             1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23, 24, 28,
+             2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 26, 28, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12,
+             13, 14, 17, 18, 19, 20, 21, 22, 25, 26, 27, 28, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13,
+             6, 14, 7, 15, 16, 24, 17, 25, 18, 26, 19, 27, 20, 28, 4, 8, 5, 9, 6, 10, 7, 11, 20, 24,
+             21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 22, 24,
+             23, 25, 26, 28, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22,
+             23, 24, 25, 26, 27, 28, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 24,
+             9, 25, 10, 26, 11, 27, 12, 28, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23,
+             4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 20, 24, 21, 25, 22, 26, 23, 27,
+             2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 19, 21, 22, 24, 23, 25,
+             26, 28, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+             23, 24, 25, 26, 27, 28,
+    /* 30 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 26, 27, 28, 29, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18,
+             17, 19, 20, 22, 21, 23, 24, 26, 25, 27, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22, 25, 26,
+             0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21, 18, 22, 19, 23,
+             24, 28, 25, 29, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 26, 28, 27, 29, 1, 2, 3, 4,
+             5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 25, 26, 27, 28, 0, 8, 1, 9, 2, 10,
+             3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24, 17, 25, 18, 26, 19, 27, 20, 28, 21, 29, 4, 8,
+             5, 9, 6, 10, 7, 11, 20, 24, 21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12,
+             11, 13, 18, 20, 19, 21, 22, 24, 23, 25, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+             11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 16, 1, 17, 2, 18, 3, 19,
+             4, 20, 5, 21, 6, 22, 7, 23, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 8, 16, 9, 17,
+             10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17,
+             14, 18, 15, 19, 20, 24, 21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13,
+             14, 16, 15, 17, 18, 20, 19, 21, 22, 24, 23, 25, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+    /* 31 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 26, 27, 28, 29, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15, 16, 18,
+             17, 19, 20, 22, 21, 23, 24, 26, 25, 27, 28, 30, 1, 2, 5, 6, 9, 10, 13, 14, 17, 18, 21, 22,
+             25, 26, 29, 30, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15, 16, 20, 17, 21,
+             18, 22, 19, 23, 24, 28, 25, 29, 26, 30, 2, 4, 3, 5, 10, 12, 11, 13, 18, 20, 19, 21, 26, 28,
+             27, 29, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 25, 26, 27, 28,
+             29, 30, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15, 16, 24, 17, 25, 18, 26,
+             19, 27, 20, 28, 21, 29, 22, 30, 4, 8, 5, 9, 6, 10, 7, 11, 20, 24, 21, 25, 22, 26, 23, 27,
+             2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21, 22, 24, 23, 25, 26, 28, 27, 29,
+             1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+             27, 28, 29, 30, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23, 8, 24, 9, 25,
+             10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 8, 16, 9, 17, 10, 18, 11, 19, 12, 20, 13, 21, 14, 22,
+             15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17, 14, 18, 15, 19, 20, 24, 21, 25, 22, 26,
+             23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 14, 16, 15, 17, 18, 20, 19, 21, 22, 24,
+             23, 25, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+    /* 32 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+             24, 25, 26, 27, 28, 29, 30, 31, 0, 2, 1, 3, 4, 6, 5, 7, 8, 10, 9, 11, 12, 14, 13, 15,
+             16, 18, 17, 19, 20, 22, 21, 23, 24, 26, 25, 27, 28, 30, 29, 31, 1, 2, 5, 6, 9, 10, 13, 14,
+             17, 18, 21, 22, 25, 26, 29, 30, 0, 4, 1, 5, 2, 6, 3, 7, 8, 12, 9, 13, 10, 14, 11, 15,
+             16, 20, 17, 21, 18, 22, 19, 23, 24, 28, 25, 29, 26, 30, 27, 31, 2, 4, 3, 5, 10, 12, 11, 13,
+             18, 20, 19, 21, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 9, 10, 11, 12, 13, 14, 17, 18, 19, 20,
+             21, 22, 25, 26, 27, 28, 29, 30, 0, 8, 1, 9, 2, 10, 3, 11, 4, 12, 5, 13, 6, 14, 7, 15,
+             16, 24, 17, 25, 18, 26, 19, 27, 20, 28, 21, 29, 22, 30, 23, 31, 4, 8, 5, 9, 6, 10, 7, 11,
+             20, 24, 21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13, 18, 20, 19, 21,
+             22, 24, 23, 25, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 17, 18,
+             19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21,
+             6, 22, 7, 23, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31, 8, 16, 9, 17,
+             10, 18, 11, 19, 12, 20, 13, 21, 14, 22, 15, 23, 4, 8, 5, 9, 6, 10, 7, 11, 12, 16, 13, 17,
+             14, 18, 15, 19, 20, 24, 21, 25, 22, 26, 23, 27, 2, 4, 3, 5, 6, 8, 7, 9, 10, 12, 11, 13,
+             14, 16, 15, 17, 18, 20, 19, 21, 22, 24, 23, 25, 26, 28, 27, 29, 1, 2, 3, 4, 5, 6, 7, 8,
+             9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30
+};
+
+#define FOSSIL_SORT_DEFINE_NETWORK(NAME, SUFFIX, T) \
+    static void fossil_network_sort_##SUFFIX(T *a, size_t n, bool desc) \
+    { \
+        const uint8_t *p = fossil_network_pairs + 2 * fossil_network_offset[n]; \
+        const uint8_t *end = fossil_network_pairs + 2 * fossil_network_offset[n + 1]; \
+        if (desc) { \
+            for (; p < end; p += 2) { \
+                T x = a[p[0]], y = a[p[1]]; \
+                bool s = x < y; \
+                a[p[0]] = s ? y : x; \
+                a[p[1]] = s ? x : y; \
+            } \
+        } else { \
+            for (; p < end; p += 2) { \
+                T x = a[p[0]], y = a[p[1]]; \
+                bool s = y < x; \
+                a[p[0]] = s ? y : x; \
+                a[p[1]] = s ? x : y; \
+            } \
+        } \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_NETWORK)
+
+// Sorts a typed array of at most FOSSIL_ALGORITHM_SORT_NETWORK_MAX elements.
+static bool fossil_sort_network_kind(void *base, size_t count, fossil_sort_kind_t kind, bool desc)
+{
+    if (count > FOSSIL_ALGORITHM_SORT_NETWORK_MAX)
+        return false;
+    if (count < 2)
+        return true;
+
+    switch (kind) {
+#define FOSSIL_SORT_CASE_NETWORK(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: fossil_network_sort_##SUFFIX((T *)base, count, desc); return true;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_NETWORK)
+#undef FOSSIL_SORT_CASE_NETWORK
+    default:
+        return false;
+    }
+}
+
+#define FOSSIL_SORT_DEFINE_NETWORK_API(NAME, SUFFIX, T) \
+    int fossil_algorithm_sort_network_##SUFFIX(T *base, size_t count, bool desc) \
+    { \
+        if ((!base && count > 0) || count > FOSSIL_ALGORITHM_SORT_NETWORK_MAX) \
+            return -1; \
+        if (count > 1) \
+            fossil_network_sort_##SUFFIX(base, count, desc); \
+        return 0; \
+    }
+
+FOSSIL_SORT_DEFINE_NETWORK_API(I8,  i8,  int8_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(I16, i16, int16_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(I32, i32, int32_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(I64, i64, int64_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(U8,  u8,  uint8_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(U16, u16, uint16_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(U32, u32, uint32_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(U64, u64, uint64_t)
+FOSSIL_SORT_DEFINE_NETWORK_API(F32, f32, float)
+FOSSIL_SORT_DEFINE_NETWORK_API(F64, f64, double)
+
+int fossil_algorithm_sort_network(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id)
+{
+    if (!base || !type_id)
+        return -1;
+
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+    if (kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    if (count > FOSSIL_ALGORITHM_SORT_NETWORK_MAX)
+        return -4;
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    fossil_sort_network_kind(base, count, kind, desc);
+    return 0;
+}
+
+// ======================================================
+// Predicate filtering
+// ======================================================
+
+typedef enum {
+    FOSSIL_FILTER_NONE,
+    FOSSIL_FILTER_EQ,
+    FOSSIL_FILTER_NE,
+    FOSSIL_FILTER_LT,
+    FOSSIL_FILTER_LE,
+    FOSSIL_FILTER_GT,
+    FOSSIL_FILTER_GE,
+    FOSSIL_FILTER_RANGE,
+    FOSSIL_FILTER_MASK
+} fossil_filter_op_t;
+
+static fossil_filter_op_t fossil_filter_select_op(const char *predicate_id)
+{
+    static const struct {
+        const char *id;
+        fossil_filter_op_t op;
+    } ops[] = {
+        {"eq", FOSSIL_FILTER_EQ}, {"ne", FOSSIL_FILTER_NE}, {"lt", FOSSIL_FILTER_LT},
+        {"le", FOSSIL_FILTER_LE}, {"gt", FOSSIL_FILTER_GT}, {"ge", FOSSIL_FILTER_GE},
+        {"range", FOSSIL_FILTER_RANGE}, {"mask", FOSSIL_FILTER_MASK}
+    };
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); ++i)
+        if (!strcmp(predicate_id, ops[i].id))
+            return ops[i].op;
+    return FOSSIL_FILTER_NONE;
+}
+
+// Every element is written to both destinations and only the matching
+// cursor advances, so the loop has no data-dependent branch to mispredict
+// and compilers can if-convert (or vectorise) it. Writing at a cursor never
+// ahead of the read index keeps in == keep and in == rest safe.
+#define FOSSIL_FILTER_LOOP(T, MATCH) \
+    do { \
+        if (rest) { \
+            for (size_t i = 0; i < n; ++i) { \
+                T x = in[i]; \
+                size_t m = (MATCH); \
+                keep[w] = x; \
+                rest[r] = x; \
+                w += m; \
+                r += m ^ 1u; \
+            } \
+        } else { \
+            for (size_t i = 0; i < n; ++i) { \
+                T x = in[i]; \
+                keep[w] = x; \
+                w += (MATCH); \
+            } \
+        } \
+    } while (0)
+
+// Splits in[] into matching (keep) and non-matching (rest, may be NULL)
+// elements, both in input order. Returns the number of matches.
+#define FOSSIL_SORT_DEFINE_FILTER(NAME, SUFFIX, T) \
+    static size_t fossil_filter_split_##SUFFIX( \
+        const T *in, size_t n, T *keep, T *rest, fossil_filter_op_t op, T lo, T hi, const uint8_t *mask) \
+    { \
+        size_t w = 0, r = 0; \
+        switch (op) { \
+        case FOSSIL_FILTER_EQ:    FOSSIL_FILTER_LOOP(T, (size_t)(x == lo)); break; \
+        case FOSSIL_FILTER_NE:    FOSSIL_FILTER_LOOP(T, (size_t)(x != lo)); break; \
+        case FOSSIL_FILTER_LT:    FOSSIL_FILTER_LOOP(T, (size_t)(x < lo)); break; \
+        case FOSSIL_FILTER_LE:    FOSSIL_FILTER_LOOP(T, (size_t)(x <= lo)); break; \
+        case FOSSIL_FILTER_GT:    FOSSIL_FILTER_LOOP(T, (size_t)(x > lo)); break; \
+        case FOSSIL_FILTER_GE:    FOSSIL_FILTER_LOOP(T, (size_t)(x >= lo)); break; \
+        case FOSSIL_FILTER_RANGE: FOSSIL_FILTER_LOOP(T, (size_t)(x >= lo) & (size_t)(x <= hi)); break; \
+        case FOSSIL_FILTER_MASK:  FOSSIL_FILTER_LOOP(T, (size_t)((mask[i >> 3] >> (i & 7)) & 1u)); break; \
+        default: break; \
+        } \
+        (void)hi; \
+        return w; \
+    } \
+    static size_t fossil_filter_run_##SUFFIX( \
+        const void *in, size_t n, void *keep, void *rest, fossil_filter_op_t op, const void *lo, const void *hi) \
+    { \
+        T lo_v = 0, hi_v = 0; \
+        const uint8_t *mask = NULL; \
+        if (op == FOSSIL_FILTER_MASK) \
+            mask = (const uint8_t *)lo; \
+        else \
+            memcpy(&lo_v, lo, sizeof(T)); \
+        if (op == FOSSIL_FILTER_RANGE) \
+            memcpy(&hi_v, hi, sizeof(T)); \
+        return fossil_filter_split_##SUFFIX((const T *)in, n, (T *)keep, (T *)rest, op, lo_v, hi_v, mask); \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_FILTER)
+
+static size_t fossil_filter_kind(
+    const void *in, size_t n, void *keep, void *rest, fossil_sort_kind_t kind,
+    fossil_filter_op_t op, const void *lo, const void *hi)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_FILTER(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_filter_run_##SUFFIX(in, n, keep, rest, op, lo, hi);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_FILTER)
+#undef FOSSIL_SORT_CASE_FILTER
+    default:
+        return 0;
+    }
+}
+
+// Shared argument checks; returns 0 or the public error code.
+static int fossil_filter_check(
+    const void *base, size_t count, const char *type_id, const char *predicate_id,
+    const void *lo, const void *hi, fossil_sort_kind_t *kind, fossil_filter_op_t *op)
+{
+    if ((count > 0 && !base) || !type_id || !predicate_id)
+        return -1;
+    *kind = fossil_sort_select_kind(type_id);
+    if (*kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    *op = fossil_filter_select_op(predicate_id);
+    if (*op == FOSSIL_FILTER_NONE)
+        return -3;
+    if ((count > 0 && !lo) || (*op == FOSSIL_FILTER_RANGE && !hi))
+        return -1;
+    return 0;
+}
+
+int fossil_algorithm_sort_partition_if(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *matched)
+{
+    fossil_sort_kind_t kind;
+    fossil_filter_op_t op;
+    int status = fossil_filter_check(base, count, type_id, predicate_id, lo, hi, &kind, &op);
+    if (status != 0)
+        return status;
+
+    size_t width = fossil_sort_kind_sizeof(kind);
+    void *rest = count ? malloc(count * width) : NULL;
+    if (count && !rest)
+        return -5;
+
+    size_t m = count ? fossil_filter_kind(base, count, base, rest, kind, op, lo, hi) : 0;
+    if (count)
+        memcpy((char *)base + m * width, rest, (count - m) * width);
+    free(rest);
+    if (matched)
+        *matched = m;
+    return 0;
+}
+
+int fossil_algorithm_sort_filter(
+    const void *base,
+    void *out,
+    size_t count,
+    const char *type_id,
+    const char *predicate_id,
+    const void *lo,
+    const void *hi,
+    size_t *matched)
+{
+    fossil_sort_kind_t kind;
+    fossil_filter_op_t op;
+    if (count > 0 && !out)
+        return -1;
+    int status = fossil_filter_check(base, count, type_id, predicate_id, lo, hi, &kind, &op);
+    if (status != 0)
+        return status;
+
+    size_t m = count ? fossil_filter_kind(base, count, out, NULL, kind, op, lo, hi) : 0;
+    if (matched)
+        *matched = m;
+    return 0;
+}
+
 // ======================================================
 // Algorithm stubs
 // ======================================================
@@ -343,257 +1020,2471 @@ static int fossil_sort_merge_stub(
     return 0;
 }
 
-static void fossil_heapify(
-    char *base, size_t count, size_t root, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+// Sortedness and natural merge
+//
+// The sorted scan compares whole blocks with a branch-free OR of the
+// descents, which the compiler can vectorise, and only walks element by
+// element inside the first block that breaks order. The run scan splits the
+// array into maximal non-descending runs and strictly descending runs; the
+// latter are reversed in place (they hold no equal keys, so stability
+// survives) and a bottom-up merge of the runs finishes the sort.
+
+#define FOSSIL_SORTED_BLOCK 32
+
+/**
+ * @brief Most runs "auto" will hand to the natural merge (at most six passes).
+ */
+#define FOSSIL_SORT_NATURAL_RUNS 64
+
+// x must be placed strictly before y.
+#define FOSSIL_SORT_BEFORE(x, y, desc) ((desc) ? (x) > (y) : (x) < (y))
+
+#define FOSSIL_SORT_DEFINE_SORTED(NAME, SUFFIX, T) \
+    static size_t fossil_sorted_until_##SUFFIX(const T *a, size_t n, bool desc) \
+    { \
+        size_t i = 1; \
+        if (desc) { \
+            for (; i + FOSSIL_SORTED_BLOCK <= n; i += FOSSIL_SORTED_BLOCK) { \
+                int bad = 0; \
+                for (size_t j = 0; j < FOSSIL_SORTED_BLOCK; ++j) \
+                    bad |= a[i + j] > a[i + j - 1]; \
+                if (bad) \
+                    break; \
+            } \
+        } else { \
+            for (; i + FOSSIL_SORTED_BLOCK <= n; i += FOSSIL_SORTED_BLOCK) { \
+                int bad = 0; \
+                for (size_t j = 0; j < FOSSIL_SORTED_BLOCK; ++j) \
+                    bad |= a[i + j] < a[i + j - 1]; \
+                if (bad) \
+                    break; \
+            } \
+        } \
+        for (; i < n; ++i) \
+            if (FOSSIL_SORT_BEFORE(a[i], a[i - 1], desc)) \
+                return i; \
+        return n; \
+    } \
+    \
+    static size_t fossil_sort_descents_##SUFFIX(const T *a, size_t n, bool desc) \
+    { \
+        size_t d = 0; \
+        for (size_t i = 1; i < n; ++i) \
+            d += FOSSIL_SORT_BEFORE(a[i], a[i - 1], desc); \
+        return d; \
+    } \
+    \
+    static size_t fossil_sort_runs_##SUFFIX(T *a, size_t n, bool desc, size_t *ends, size_t limit) \
+    { \
+        size_t runs = 0, i = 0; \
+        while (i < n) { \
+            size_t j = i + 1; \
+            if (j < n && FOSSIL_SORT_BEFORE(a[j], a[j - 1], desc)) { \
+                while (j < n && FOSSIL_SORT_BEFORE(a[j], a[j - 1], desc)) \
+                    ++j; \
+                for (size_t lo = i, hi = j - 1; lo < hi; ++lo, --hi) { \
+                    T t = a[lo]; \
+                    a[lo] = a[hi]; \
+                    a[hi] = t; \
+                } \
+            } else { \
+                j = i + fossil_sorted_until_##SUFFIX(a + i, n - i, desc); \
+            } \
+            if (++runs > limit) \
+                return runs; \
+            ends[runs - 1] = j; \
+            i = j; \
+        } \
+        return runs; \
+    } \
+    \
+    static void fossil_natural_merge_##SUFFIX(T *a, size_t n, size_t *ends, size_t runs, T *tmp, bool desc) \
+    { \
+        T *src = a, *dst = tmp; \
+        while (runs > 1) { \
+            size_t w = 0, start = 0; \
+            for (size_t r = 0; r < runs; r += 2) { \
+                size_t mid = ends[r]; \
+                size_t end = r + 1 < runs ? ends[r + 1] : mid; \
+                size_t i = start, j = mid, k = start; \
+                if (j < end && FOSSIL_SORT_BEFORE(src[j], src[j - 1], desc)) { \
+                    while (i < mid && j < end) { \
+                        bool right = FOSSIL_SORT_BEFORE(src[j], src[i], desc); \
+                        dst[k++] = right ? src[j] : src[i]; \
+                        j += right; \
+                        i += !right; \
+                    } \
+                } \
+                memcpy(dst + k, src + i, (mid - i) * sizeof(T)); \
+                k += mid - i; \
+                memcpy(dst + k, src + j, (end - j) * sizeof(T)); \
+                ends[w++] = end; \
+                start = end; \
+            } \
+            runs = w; \
+            T *t = src; \
+            src = dst; \
+            dst = t; \
+        } \
+        if (src != a) \
+            memcpy(a, src, n * sizeof(T)); \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_SORTED)
+
+static size_t fossil_sorted_until_generic(
+    const char *a, size_t n, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    for (size_t i = 1; i < n; ++i)
+        if (cmp(a + i * type_size, a + (i - 1) * type_size, desc) < 0)
+            return i;
+    return n;
+}
+
+static size_t fossil_sort_runs_generic(
+    char *a, size_t n, size_t type_size, fossil_sort_compare_fn cmp, bool desc, size_t *ends, size_t limit)
+{
+    fossil_sort_elem_t t;
+    size_t runs = 0, i = 0;
+    while (i < n) {
+        size_t j = i + 1;
+        if (j < n && cmp(a + j * type_size, a + (j - 1) * type_size, desc) < 0) {
+            while (j < n && cmp(a + j * type_size, a + (j - 1) * type_size, desc) < 0)
+                ++j;
+            for (size_t lo = i, hi = j - 1; lo < hi; ++lo, --hi) {
+                memcpy(t.bytes, a + lo * type_size, type_size);
+                memcpy(a + lo * type_size, a + hi * type_size, type_size);
+                memcpy(a + hi * type_size, t.bytes, type_size);
+            }
+        } else {
+            j = i + fossil_sorted_until_generic(a + i * type_size, n - i, type_size, cmp, desc);
+        }
+        if (++runs > limit)
+            return runs;
+        ends[runs - 1] = j;
+        i = j;
+    }
+    return runs;
+}
+
+static void fossil_natural_merge_generic(
+    char *a, size_t n, size_t *ends, size_t runs, char *tmp, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
 {
-    size_t largest = root;
-    size_t left = 2 * root + 1;
-    size_t right = 2 * root + 2;
+    char *src = a, *dst = tmp;
+    while (runs > 1) {
+        size_t w = 0, start = 0;
+        for (size_t r = 0; r < runs; r += 2) {
+            size_t mid = ends[r];
+            size_t end = r + 1 < runs ? ends[r + 1] : mid;
+            size_t i = start, j = mid, k = start;
+            while (i < mid && j < end) {
+                if (cmp(src + j * type_size, src + i * type_size, desc) < 0)
+                    memcpy(dst + k++ * type_size, src + j++ * type_size, type_size);
+                else
+                    memcpy(dst + k++ * type_size, src + i++ * type_size, type_size);
+            }
+            memcpy(dst + k * type_size, src + i * type_size, (mid - i) * type_size);
+            k += mid - i;
+            memcpy(dst + k * type_size, src + j * type_size, (end - j) * type_size);
+            ends[w++] = end;
+            start = end;
+        }
+        runs = w;
+        char *t = src;
+        src = dst;
+        dst = t;
+    }
+    if (src != a)
+        memcpy(a, src, n * type_size);
+}
 
-    char *tmp = malloc(type_size);
-    if (!tmp) return;
+static size_t fossil_sorted_until_kind(
+    const void *base, size_t n, fossil_sort_kind_t kind, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_SORTED(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_sorted_until_##SUFFIX((const T *)base, n, desc);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_SORTED)
+#undef FOSSIL_SORT_CASE_SORTED
+    default:
+        return fossil_sorted_until_generic((const char *)base, n, type_size, cmp, desc);
+    }
+}
+
+static size_t fossil_sort_descents_kind(
+    const void *base, size_t n, fossil_sort_kind_t kind, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_DESCENTS(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_sort_descents_##SUFFIX((const T *)base, n, desc);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_DESCENTS)
+#undef FOSSIL_SORT_CASE_DESCENTS
+    default: {
+        const char *a = (const char *)base;
+        size_t d = 0;
+        for (size_t i = 1; i < n; ++i)
+            d += cmp(a + i * type_size, a + (i - 1) * type_size, desc) < 0;
+        return d;
+    }
+    }
+}
 
-    if (left < count && cmp(base + left * type_size, base + largest * type_size, desc) > 0)
-        largest = left;
-    if (right < count && cmp(base + right * type_size, base + largest * type_size, desc) > 0)
-        largest = right;
+static size_t fossil_sort_runs_kind(
+    void *base, size_t n, fossil_sort_kind_t kind, size_t type_size, fossil_sort_compare_fn cmp, bool desc,
+    size_t *ends, size_t limit)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_RUNS(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_sort_runs_##SUFFIX((T *)base, n, desc, ends, limit);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_RUNS)
+#undef FOSSIL_SORT_CASE_RUNS
+    default:
+        return fossil_sort_runs_generic((char *)base, n, type_size, cmp, desc, ends, limit);
+    }
+}
 
-    if (largest != root) {
-        memcpy(tmp, base + root * type_size, type_size);
-        memcpy(base + root * type_size, base + largest * type_size, type_size);
-        memcpy(base + largest * type_size, tmp, type_size);
+static void fossil_natural_merge_kind(
+    void *base, size_t n, size_t *ends, size_t runs, void *tmp, fossil_sort_kind_t kind, size_t type_size,
+    fossil_sort_compare_fn cmp, bool desc)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_NATURAL(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: fossil_natural_merge_##SUFFIX((T *)base, n, ends, runs, (T *)tmp, desc); return;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_NATURAL)
+#undef FOSSIL_SORT_CASE_NATURAL
+    default:
+        fossil_natural_merge_generic((char *)base, n, ends, runs, (char *)tmp, type_size, cmp, desc);
+        return;
+    }
+}
 
-        fossil_heapify(base, count, largest, type_size, cmp, desc);
+// Heap Sort
+//
+// Bottom-up (Floyd/Wegener) sift-down on a 4-ary heap. The hole left by the
+// root walks down to a leaf along the preferred children and the displaced
+// element is then sifted back up, which needs roughly half the comparisons of
+// the classic swap-based sift. Four children share a cache line for all the
+// fixed-width types, and the whole sort runs without recursion or allocation.
+
+#define FOSSIL_HEAP_ARITY 4
+
+#define FOSSIL_SORT_DEFINE_HEAP(NAME, SUFFIX, T) \
+    static void fossil_heap_sift_##SUFFIX(T *a, size_t hole, size_t n, T x, bool desc) \
+    { \
+        size_t top = hole; \
+        size_t child; \
+        while ((child = FOSSIL_HEAP_ARITY * hole + 1) < n) { \
+            size_t best = child; \
+            size_t last = (n - child > FOSSIL_HEAP_ARITY) ? child + FOSSIL_HEAP_ARITY : n; \
+            for (size_t c = child + 1; c < last; ++c) \
+                if (desc ? a[c] < a[best] : a[c] > a[best]) best = c; \
+            a[hole] = a[best]; \
+            hole = best; \
+        } \
+        while (hole > top) { \
+            size_t parent = (hole - 1) / FOSSIL_HEAP_ARITY; \
+            if (!(desc ? x < a[parent] : x > a[parent])) break; \
+            a[hole] = a[parent]; \
+            hole = parent; \
+        } \
+        a[hole] = x; \
+    } \
+    static void fossil_heap_sort_##SUFFIX(T *a, size_t n, bool desc) \
+    { \
+        for (size_t i = (n - 2) / FOSSIL_HEAP_ARITY + 1; i-- > 0;) \
+            fossil_heap_sift_##SUFFIX(a, i, n, a[i], desc); \
+        for (size_t end = n - 1; end > 0; --end) { \
+            T x = a[end]; \
+            a[end] = a[0]; \
+            fossil_heap_sift_##SUFFIX(a, 0, end, x, desc); \
+        } \
     }
-    free(tmp);
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_HEAP)
+
+static void fossil_heap_sift_generic(
+    char *base, size_t hole, size_t n, const void *x, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    size_t top = hole;
+    size_t child;
+    while ((child = FOSSIL_HEAP_ARITY * hole + 1) < n) {
+        size_t best = child;
+        size_t last = (n - child > FOSSIL_HEAP_ARITY) ? child + FOSSIL_HEAP_ARITY : n;
+        for (size_t c = child + 1; c < last; ++c)
+            if (cmp(base + c * type_size, base + best * type_size, desc) > 0) best = c;
+        memcpy(base + hole * type_size, base + best * type_size, type_size);
+        hole = best;
+    }
+    while (hole > top) {
+        size_t parent = (hole - 1) / FOSSIL_HEAP_ARITY;
+        if (cmp(x, base + parent * type_size, desc) <= 0) break;
+        memcpy(base + hole * type_size, base + parent * type_size, type_size);
+        hole = parent;
+    }
+    memcpy(base + hole * type_size, x, type_size);
 }
 
 static int fossil_sort_heap_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
 {
-    if (!base || count < 2 || !cmp || type_size == 0)
+    if (!base || count < 2 || !cmp || type_size == 0 || type_size > FOSSIL_SORT_ELEM_MAX)
         return -11;
 
+    switch (kind) {
+#define FOSSIL_SORT_CASE_HEAP(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: fossil_heap_sort_##SUFFIX((T *)base, count, desc); return 0;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_HEAP)
+#undef FOSSIL_SORT_CASE_HEAP
+    default:
+        break;
+    }
+
     char *arr = (char *)base;
+    fossil_sort_elem_t x;
 
     // Build heap
-    for (long i = (long)count / 2 - 1; i >= 0; --i)
-        fossil_heapify(arr, count, (size_t)i, type_size, cmp, desc);
-
-    char *tmp = malloc(type_size);
-    if (!tmp) return -11;
+    for (size_t i = (count - 2) / FOSSIL_HEAP_ARITY + 1; i-- > 0;) {
+        memcpy(x.bytes, arr + i * type_size, type_size);
+        fossil_heap_sift_generic(arr, i, count, x.bytes, type_size, cmp, desc);
+    }
 
     // Extract elements from heap
-    for (size_t i = count - 1; i > 0; --i) {
-        memcpy(tmp, arr, type_size);
-        memcpy(arr, arr + i * type_size, type_size);
-        memcpy(arr + i * type_size, tmp, type_size);
-
-        fossil_heapify(arr, i, 0, type_size, cmp, desc);
+    for (size_t end = count - 1; end > 0; --end) {
+        memcpy(x.bytes, arr + end * type_size, type_size);
+        memcpy(arr + end * type_size, arr, type_size);
+        fossil_heap_sift_generic(arr, 0, end, x.bytes, type_size, cmp, desc);
     }
-    free(tmp);
     return 0;
 }
 
 static int fossil_sort_insertion_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
 {
-    if (!base || count < 2 || !cmp || type_size == 0)
+    if (!base || count < 2 || !cmp || type_size == 0 || type_size > FOSSIL_SORT_ELEM_MAX)
         return -12;
 
-    char *arr = (char *)base;
-    char *tmp = malloc(type_size);
-    if (!tmp) return -12;
-
-    for (size_t i = 1; i < count; ++i) {
-        memcpy(tmp, arr + i * type_size, type_size);
-        size_t j = i;
-        while (j > 0 && cmp(arr + (j - 1) * type_size, tmp, desc) > 0) {
-            memcpy(arr + j * type_size, arr + (j - 1) * type_size, type_size);
-            --j;
-        }
-        memcpy(arr + j * type_size, tmp, type_size);
-    }
-    free(tmp);
+    if (!fossil_sort_insertion_kind(base, count, kind, desc))
+        fossil_insertion_sort_generic((char *)base, count, type_size, cmp, desc);
     return 0;
 }
 
 // Shell Sort
+//
+// Ciura's empirically tuned gaps, extended geometrically by 2.25 past 1750
+// (the usual Tokuda-style continuation), keep the sort near O(n^1.25) on
+// realistic inputs where halving gaps fall apart. No recursion, no heap.
+
+static const uint32_t fossil_shell_gaps[] = {
+    1u, 4u, 10u, 23u, 57u, 132u, 301u, 701u, 1750u,
+    3937u, 8858u, 19930u, 44842u, 100894u, 227011u, 510774u,
+    1149241u, 2585792u, 5818032u, 13090572u, 29453787u, 66271020u,
+    149109795u, 335497038u, 754868335u, 1698453753u, 3821520944u
+};
+
+// Index of the largest gap smaller than count.
+static size_t fossil_shell_first_gap(size_t count)
+{
+    size_t g = 0;
+    while (g + 1 < sizeof(fossil_shell_gaps) / sizeof(fossil_shell_gaps[0]) &&
+           (size_t)fossil_shell_gaps[g + 1] < count)
+        ++g;
+    return g;
+}
+
+#define FOSSIL_SORT_DEFINE_SHELL(NAME, SUFFIX, T) \
+    static void fossil_shell_sort_##SUFFIX(T *a, size_t n, bool desc) \
+    { \
+        for (size_t g = fossil_shell_first_gap(n) + 1; g-- > 0;) { \
+            size_t gap = fossil_shell_gaps[g]; \
+            for (size_t i = gap; i < n; ++i) { \
+                T x = a[i]; \
+                size_t j = i; \
+                while (j >= gap && (desc ? a[j - gap] < x : a[j - gap] > x)) { \
+                    a[j] = a[j - gap]; \
+                    j -= gap; \
+                } \
+                a[j] = x; \
+            } \
+        } \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_SHELL)
+
 static int fossil_sort_shell_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
 {
-    if (!base || count < 2 || !cmp || type_size == 0)
+    if (!base || count < 2 || !cmp || type_size == 0 || type_size > FOSSIL_SORT_ELEM_MAX)
         return -13;
 
+    switch (kind) {
+#define FOSSIL_SORT_CASE_SHELL(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: fossil_shell_sort_##SUFFIX((T *)base, count, desc); return 0;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_SHELL)
+#undef FOSSIL_SORT_CASE_SHELL
+    default:
+        break;
+    }
+
     char *arr = (char *)base;
-    char *tmp = malloc(type_size);
-    if (!tmp) return -13;
+    fossil_sort_elem_t tmp;
 
-    for (size_t gap = count / 2; gap > 0; gap /= 2) {
+    for (size_t g = fossil_shell_first_gap(count) + 1; g-- > 0;) {
+        size_t gap = fossil_shell_gaps[g];
         for (size_t i = gap; i < count; ++i) {
-            memcpy(tmp, arr + i * type_size, type_size);
+            memcpy(tmp.bytes, arr + i * type_size, type_size);
             size_t j = i;
-            while (j >= gap && cmp(arr + (j - gap) * type_size, tmp, desc) > 0) {
+            while (j >= gap && cmp(arr + (j - gap) * type_size, tmp.bytes, desc) > 0) {
                 memcpy(arr + j * type_size, arr + (j - gap) * type_size, type_size);
                 j -= gap;
             }
-            memcpy(arr + j * type_size, tmp, type_size);
+            memcpy(arr + j * type_size, tmp.bytes, type_size);
         }
     }
-    free(tmp);
     return 0;
 }
 
-// Bubble Sort
-static int fossil_sort_bubble_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
-{
-    if (!base || count < 2 || !cmp || type_size == 0)
-        return -14;
+// Quick Sort
+//
+// Introsort with Dijkstra's three-way (Dutch flag) partition: elements equal
+// to the pivot form a fat middle band that is never touched again, so inputs
+// with heavy key duplication finish in O(n * distinct) instead of degrading.
+// Recursion goes into the smaller side only, the depth limit falls back to
+// heap sort, and short ranges finish in a sorting network.
 
-    char *arr = (char *)base;
-    char *tmp = malloc(type_size);
-    if (!tmp) return -14;
+#define FOSSIL_QUICK_CUTOFF FOSSIL_ALGORITHM_SORT_NETWORK_MAX
 
-    for (size_t i = 0; i < count - 1; ++i) {
-        for (size_t j = 0; j < count - i - 1; ++j) {
-            if (cmp(arr + j * type_size, arr + (j + 1) * type_size, desc) > 0) {
-                memcpy(tmp, arr + j * type_size, type_size);
-                memcpy(arr + j * type_size, arr + (j + 1) * type_size, type_size);
-                memcpy(arr + (j + 1) * type_size, tmp, type_size);
-            }
-        }
+static unsigned fossil_quick_depth_limit(size_t count)
+{
+    unsigned depth = 0;
+    while (count > 1) {
+        count >>= 1;
+        depth += 2;
     }
-    free(tmp);
-    return 0;
+    return depth;
 }
 
-// Counting Sort (only for integer types)
-static int fossil_sort_counting_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
-{
-    // Only supports u8 for simplicity
-    if (!base || count < 2 || !cmp || type_size != sizeof(uint8_t))
-        return -15;
+#define FOSSIL_SORT_DEFINE_QUICK(NAME, SUFFIX, T) \
+    static T fossil_quick_med3_##SUFFIX(T x, T y, T z) \
+    { \
+        if (x < y) return y < z ? y : (x < z ? z : x); \
+        return x < z ? x : (y < z ? z : y); \
+    } \
+    static T fossil_quick_pivot_##SUFFIX(const T *a, size_t n) \
+    { \
+        size_t m = n / 2; \
+        if (n <= 128) \
+            return fossil_quick_med3_##SUFFIX(a[0], a[m], a[n - 1]); \
+        size_t s = n / 8; \
+        return fossil_quick_med3_##SUFFIX( \
+            fossil_quick_med3_##SUFFIX(a[0], a[s], a[2 * s]), \
+            fossil_quick_med3_##SUFFIX(a[m - s], a[m], a[m + s]), \
+            fossil_quick_med3_##SUFFIX(a[n - 1 - 2 * s], a[n - 1 - s], a[n - 1])); \
+    } \
+    /* Three-way partition into [0, lt) before, [lt, gt) equal and \
+       [gt, n) after the pivot; an unordered pivot (NaN) reports gt == 0. \
+       With scratch it is two branch-free filter passes: keys ordered \
+       before the pivot stay in place, the rest go to scratch and split \
+       into equal and after. Without it, a Dutch-flag pass in place. */ \
+    static void fossil_quick_partition_##SUFFIX( \
+        T *a, size_t n, T p, T *scratch, bool desc, size_t *lt, size_t *gt) \
+    { \
+        if (!scratch) { \
+            size_t l = 0, i = 0, g = n; \
+            bool eq = false; \
+            while (i < g) { \
+                T x = a[i]; \
+                if (desc ? x > p : x < p) { \
+                    a[i++] = a[l]; \
+                    a[l++] = x; \
+                } else if (desc ? x < p : x > p) { \
+                    a[i] = a[--g]; \
+                    a[g] = x; \
+                } else { \
+                    eq |= x == p; \
+                    ++i; \
+                } \
+            } \
+            /* The pivot is drawn from a, so only NaN matches nothing. */ \
+            *lt = eq ? l : 0; \
+            *gt = eq ? g : 0; \
+            return; \
+        } \
+        fossil_filter_op_t before = desc ? FOSSIL_FILTER_GT : FOSSIL_FILTER_LT; \
+        size_t l = fossil_filter_split_##SUFFIX(a, n, a, scratch, before, p, p, NULL); \
+        size_t e = fossil_filter_split_##SUFFIX(scratch, n - l, a + l, scratch, FOSSIL_FILTER_EQ, p, p, NULL); \
+        memcpy(a + l + e, scratch, (n - l - e) * sizeof(T)); \
+        *lt = l; \
+        *gt = l + e; \
+    } \
+    static void fossil_quick_sort_##SUFFIX(T *a, size_t n, bool desc, unsigned depth, T *scratch) \
+    { \
+        while (n > FOSSIL_QUICK_CUTOFF) { \
+            if (depth == 0) { \
+                fossil_heap_sort_##SUFFIX(a, n, desc); \
+                return; \
+            } \
+            --depth; \
+            T p = fossil_quick_pivot_##SUFFIX(a, n); \
+            size_t lt, gt; \
+            fossil_quick_partition_##SUFFIX(a, n, p, scratch, desc, &lt, &gt); \
+            if (gt == 0) /* unordered pivot (NaN) */ \
+                depth = 0; \
+            if (lt < n - gt) { \
+                fossil_quick_sort_##SUFFIX(a, lt, desc, depth, scratch); \
+                a += gt; \
+                n -= gt; \
+            } else { \
+                fossil_quick_sort_##SUFFIX(a + gt, n - gt, desc, depth, scratch); \
+                n = lt; \
+            } \
+        } \
+        if (n > 1) \
+            fossil_network_sort_##SUFFIX(a, n, desc); \
+    }
 
-    uint8_t *arr = (uint8_t *)base;
-    uint8_t max = arr[0], min = arr[0];
-    for (size_t i = 1; i < count; ++i) {
-        if (arr[i] > max) max = arr[i];
-        if (arr[i] < min) min = arr[i];
-    }
-    size_t range = max - min + 1;
-    size_t *count_arr = calloc(range, sizeof(size_t));
-    if (!count_arr) return -15;
-
-    for (size_t i = 0; i < count; ++i)
-        count_arr[arr[i] - min]++;
-
-    if (!desc) {
-        size_t idx = 0;
-        for (size_t i = 0; i < range; ++i)
-            for (size_t j = 0; j < count_arr[i]; ++j)
-                arr[idx++] = (uint8_t)(i + min);
-    } else {
-        size_t idx = 0;
-        for (size_t i = range; i-- > 0;)
-            for (size_t j = 0; j < count_arr[i]; ++j)
-                arr[idx++] = (uint8_t)(i + min);
-    }
-    free(count_arr);
-    return 0;
-}
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_QUICK)
 
-// Radix Sort (only for u32)
-static int fossil_sort_radix_stub(
-    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+static void fossil_quick_swap_generic(char *x, char *y, size_t type_size)
 {
-    if (!base || count < 2 || !cmp || type_size != sizeof(uint32_t))
-        return -16;
+    fossil_sort_elem_t tmp;
+    memcpy(tmp.bytes, x, type_size);
+    memcpy(x, y, type_size);
+    memcpy(y, tmp.bytes, type_size);
+}
 
-    uint32_t *arr = (uint32_t *)base;
-    uint32_t max = arr[0];
-    for (size_t i = 1; i < count; ++i)
-        if (arr[i] > max) max = arr[i];
-
-    uint32_t *output = malloc(count * sizeof(uint32_t));
-    if (!output) return -16;
-
-    for (uint32_t exp = 1; max / exp > 0; exp *= 10) {
-        size_t bucket[10] = {0};
-        for (size_t i = 0; i < count; ++i)
-            bucket[(arr[i] / exp) % 10]++;
-        for (size_t i = 1; i < 10; ++i)
-            bucket[i] += bucket[i - 1];
-        for (size_t i = count; i-- > 0;) {
-            size_t idx = (arr[i] / exp) % 10;
-            output[--bucket[idx]] = arr[i];
+static void fossil_quick_sort_generic(
+    char *a, size_t n, size_t type_size, fossil_sort_compare_fn cmp, bool desc, unsigned depth)
+{
+    while (n > FOSSIL_QUICK_CUTOFF) {
+        if (depth == 0) {
+            fossil_sort_heap_stub(a, n, type_size, FOSSIL_SORT_KIND_NONE, cmp, desc);
+            return;
+        }
+        --depth;
+
+        // Median of three, copied out so the partition can move it.
+        char *x = a, *y = a + (n / 2) * type_size, *z = a + (n - 1) * type_size;
+        char *m;
+        if (cmp(x, y, desc) < 0)
+            m = cmp(y, z, desc) < 0 ? y : (cmp(x, z, desc) < 0 ? z : x);
+        else
+            m = cmp(x, z, desc) < 0 ? x : (cmp(y, z, desc) < 0 ? z : y);
+        fossil_sort_elem_t p;
+        memcpy(p.bytes, m, type_size);
+
+        size_t lt = 0, i = 0, gt = n;
+        while (i < gt) {
+            int c = cmp(a + i * type_size, p.bytes, desc);
+            if (c < 0)
+                fossil_quick_swap_generic(a + (lt++) * type_size, a + (i++) * type_size, type_size);
+            else if (c > 0)
+                fossil_quick_swap_generic(a + i * type_size, a + (--gt) * type_size, type_size);
+            else
+                ++i;
+        }
+        if (lt < n - gt) {
+            fossil_quick_sort_generic(a, lt, type_size, cmp, desc, depth);
+            a += gt * type_size;
+            n -= gt;
+        } else {
+            fossil_quick_sort_generic(a + gt * type_size, n - gt, type_size, cmp, desc, depth);
+            n = lt;
         }
-        memcpy(arr, output, count * sizeof(uint32_t));
     }
-    if (desc) {
-        for (size_t i = 0; i < count / 2; ++i) {
-            uint32_t tmp = arr[i];
-            arr[i] = arr[count - i - 1];
-            arr[count - i - 1] = tmp;
+    if (n > 1)
+        fossil_insertion_sort_generic(a, n, type_size, cmp, desc);
+}
+
+static int fossil_sort_quick_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (!base || count < 2 || !cmp || type_size == 0 || type_size > FOSSIL_SORT_ELEM_MAX)
+        return -17;
+
+    unsigned depth = fossil_quick_depth_limit(count);
+    if (kind != FOSSIL_SORT_KIND_NONE) {
+        // Scratch enables the branch-free partition; without it the sort
+        // stays in place.
+        void *scratch = malloc(count * type_size);
+        switch (kind) {
+#define FOSSIL_SORT_CASE_QUICK(NAME, SUFFIX, T) \
+        case FOSSIL_SORT_KIND_##NAME: fossil_quick_sort_##SUFFIX((T *)base, count, desc, depth, (T *)scratch); break;
+        FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_QUICK)
+#undef FOSSIL_SORT_CASE_QUICK
+        default:
+            break;
         }
+        free(scratch);
+        return 0;
     }
-    free(output);
+
+    fossil_quick_sort_generic((char *)base, count, type_size, cmp, desc, depth);
     return 0;
 }
 
-// ======================================================
-// Algorithm dispatch (all algorithms implemented as stubs)
-// ======================================================
+// Selection
+//
+// Introselect with Floyd-Rivest pivots. For a large range the pivot is the
+// k-th element of a small window around position k (selected recursively),
+// so one three-way partition usually lands within a few elements of k.
+// Several ranks are served by one recursion: partition at the middle
+// requested rank, then send the smaller and larger ranks to their sides,
+// which places m order statistics in O(n log m) rather than O(n log n).
 
-int fossil_algorithm_sort_exec(
-    void *base,
-    size_t count,
-    const char *type_id,
-    const char *algorithm_id,
-    const char *order_id)
+#define FOSSIL_SELECT_SAMPLE_MIN 600
+
+// Floyd-Rivest window [*l, *r) around k inside [0, n).
+static void fossil_select_window(size_t n, size_t k, size_t *l, size_t *r)
 {
-    if (!base || count == 0 || !type_id)
-        return -1; // invalid input
+    double dn = (double)n;
+    double z = log(dn);
+    double s = 0.5 * exp(2.0 * z / 3.0);
+    double i = (double)k - dn / 2.0;
+    double sd = 0.5 * sqrt(z * s * (dn - s) / dn) * (i < 0 ? -1.0 : 1.0);
+    double lo = (double)k - (double)k * s / dn + sd;
+    double hi = (double)k + (dn - (double)k) * s / dn + sd;
+    *l = lo > 0.0 ? (size_t)lo : 0;
+    *r = hi < dn ? (size_t)hi + 1 : n;
+    if (*l > k) *l = k;
+    if (*r <= k) *r = k + 1;
+}
 
-    bool desc = false;
-    if (order_id && strcmp(order_id, "desc") == 0)
-        desc = true;
+#define FOSSIL_SORT_DEFINE_SELECT(NAME, SUFFIX, T) \
+    static T fossil_select_pivot_##SUFFIX(T *a, size_t n, size_t k, bool desc, unsigned depth, T *scratch); \
+    /* Places the k-th element (in sort order) at a[k]. */ \
+    static void fossil_select_##SUFFIX(T *a, size_t n, size_t k, bool desc, unsigned depth, T *scratch) \
+    { \
+        while (n > FOSSIL_QUICK_CUTOFF) { \
+            if (depth == 0) { \
+                fossil_heap_sort_##SUFFIX(a, n, desc); \
+                return; \
+            } \
+            --depth; \
+            T p = fossil_select_pivot_##SUFFIX(a, n, k, desc, depth, scratch); \
+            size_t lt, gt; \
+            fossil_quick_partition_##SUFFIX(a, n, p, scratch, desc, &lt, &gt); \
+            if (gt == 0) /* unordered pivot (NaN) */ \
+                depth = 0; \
+            else if (k < lt) \
+                n = lt; \
+            else if (k >= gt) { \
+                a += gt; \
+                n -= gt; \
+                k -= gt; \
+            } else \
+                return; \
+        } \
+        if (n > 1) \
+            fossil_network_sort_##SUFFIX(a, n, desc); \
+    } \
+    static T fossil_select_pivot_##SUFFIX(T *a, size_t n, size_t k, bool desc, unsigned depth, T *scratch) \
+    { \
+        if (n <= FOSSIL_SELECT_SAMPLE_MIN) \
+            return fossil_quick_pivot_##SUFFIX(a, n); \
+        size_t l, r; \
+        fossil_select_window(n, k, &l, &r); \
+        fossil_select_##SUFFIX(a + l, r - l, k - l, desc, depth, scratch); \
+        return a[k]; \
+    } \
+    /* Places every rank of ranks[0 .. m) (ascending, counted from a - off) \
+       at its final position. */ \
+    static void fossil_select_many_##SUFFIX( \
+        T *a, size_t n, size_t off, const size_t *ranks, size_t m, bool desc, unsigned depth, T *scratch) \
+    { \
+        while (m > 1 && n > FOSSIL_QUICK_CUTOFF) { \
+            if (depth == 0) { \
+                fossil_heap_sort_##SUFFIX(a, n, desc); \
+                return; \
+            } \
+            --depth; \
+            size_t k = ranks[m / 2] - off; \
+            T p = fossil_select_pivot_##SUFFIX(a, n, k, desc, depth, scratch); \
+            size_t lt, gt; \
+            fossil_quick_partition_##SUFFIX(a, n, p, scratch, desc, &lt, &gt); \
+            if (gt == 0) { \
+                depth = 0; \
+                continue; \
+            } \
+            size_t left = 0, right = m; \
+            while (left < m && ranks[left] - off < lt) ++left; \
+            while (right > left && ranks[right - 1] - off >= gt) --right; \
+            if (left < m - right) { \
+                fossil_select_many_##SUFFIX(a, lt, off, ranks, left, desc, depth, scratch); \
+                a += gt; \
+                n -= gt; \
+                off += gt; \
+                ranks += right; \
+                m -= right; \
+            } else { \
+                fossil_select_many_##SUFFIX(a + gt, n - gt, off + gt, ranks + right, m - right, desc, depth, scratch); \
+                n = lt; \
+                m = left; \
+            } \
+        } \
+        if (m == 1) \
+            fossil_select_##SUFFIX(a, n, ranks[0] - off, desc, depth, scratch); \
+        else if (m > 1 && n > 1) \
+            fossil_network_sort_##SUFFIX(a, n, desc); \
+    }
 
-    size_t type_size = fossil_algorithm_sort_type_sizeof(type_id);
-    if (type_size == 0)
-        return -2; // unknown type
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_SELECT)
 
-    fossil_sort_compare_fn cmp = fossil_sort_select_comparator(type_id);
-    if (!cmp)
-        return -2;
+// Low-cardinality sort
+//
+// A sample of the input is checked for repeated keys. When it looks like the
+// column holds few distinct values, one pass builds a hash table of distinct
+// keys and their counts, the (small) key set is sorted, and the runs are
+// written back. The pass bails out untouched if the distinct count exceeds
+// FOSSIL_SORT_LOWCARD_MAX. 8-bit kinds always use a plain counting sort.
 
-    // Dispatch to algorithm
-    if (!algorithm_id || !strcmp(algorithm_id, "auto"))
-    {
-        return fossil_sort_merge_stub(base, count, type_size, cmp, desc);
+#define FOSSIL_SORT_LOWCARD_SAMPLE    256
+#define FOSSIL_SORT_LOWCARD_MAX       4096
+#define FOSSIL_SORT_LOWCARD_MIN_COUNT 1024
+
+static inline uint64_t fossil_sort_hash_bits(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+#define FOSSIL_SORT_DEFINE_LOWCARD(NAME, SUFFIX, T) \
+    static bool fossil_lowcard_sample_##SUFFIX(const T *a, size_t n) \
+    { \
+        uint64_t seen[2 * FOSSIL_SORT_LOWCARD_SAMPLE]; \
+        unsigned char used[2 * FOSSIL_SORT_LOWCARD_SAMPLE]; \
+        size_t mask = 2 * FOSSIL_SORT_LOWCARD_SAMPLE - 1; \
+        size_t step = n / FOSSIL_SORT_LOWCARD_SAMPLE; \
+        size_t distinct = 0; \
+        memset(used, 0, sizeof(used)); \
+        for (size_t s = 0; s < FOSSIL_SORT_LOWCARD_SAMPLE; ++s) { \
+            uint64_t bits = 0; \
+            memcpy(&bits, &a[s * step + (s % step)], sizeof(T)); \
+            size_t h = (size_t)fossil_sort_hash_bits(bits) & mask; \
+            while (used[h] && seen[h] != bits) h = (h + 1) & mask; \
+            if (!used[h]) { \
+                used[h] = 1; \
+                seen[h] = bits; \
+                ++distinct; \
+            } \
+        } \
+        return distinct * 4 <= FOSSIL_SORT_LOWCARD_SAMPLE * 3; \
+    } \
+    static bool fossil_lowcard_sort_##SUFFIX(T *a, size_t n, bool desc, size_t *kept) \
+    { \
+        size_t cap = 2 * FOSSIL_SORT_LOWCARD_MAX; \
+        T *keys = malloc(cap * sizeof(T)); \
+        size_t *counts = calloc(cap, sizeof(size_t)); \
+        if (!keys || !counts) { \
+            free(keys); \
+            free(counts); \
+            return false; \
+        } \
+        size_t distinct = 0; \
+        for (size_t i = 0; i < n; ++i) { \
+            uint64_t bits = 0, other = 0; \
+            memcpy(&bits, &a[i], sizeof(T)); \
+            size_t h = (size_t)fossil_sort_hash_bits(bits) & (cap - 1); \
+            while (counts[h]) { \
+                memcpy(&other, &keys[h], sizeof(T)); \
+                if (other == bits) break; \
+                h = (h + 1) & (cap - 1); \
+            } \
+            if (!counts[h]) { \
+                if (++distinct > FOSSIL_SORT_LOWCARD_MAX) { \
+                    free(keys); \
+                    free(counts); \
+                    return false; \
+                } \
+                keys[h] = a[i]; \
+            } \
+            counts[h]++; \
+        } \
+        size_t k = 0; \
+        for (size_t h = 0; h < cap; ++h) { \
+            if (counts[h]) { \
+                keys[k] = keys[h]; \
+                counts[k] = counts[h]; \
+                ++k; \
+            } \
+        } \
+        for (size_t g = fossil_shell_first_gap(k) + 1; g-- > 0;) { \
+            size_t gap = fossil_shell_gaps[g]; \
+            for (size_t i = gap; i < k; ++i) { \
+                T x = keys[i]; \
+                size_t c = counts[i]; \
+                size_t j = i; \
+                while (j >= gap && (desc ? keys[j - gap] < x : keys[j - gap] > x)) { \
+                    keys[j] = keys[j - gap]; \
+                    counts[j] = counts[j - gap]; \
+                    j -= gap; \
+                } \
+                keys[j] = x; \
+                counts[j] = c; \
+            } \
+        } \
+        size_t pos = 0; \
+        for (size_t j = 0; j < k; ++j) \
+            for (size_t c = kept ? counts[j] - 1 : 0; c < counts[j]; ++c) \
+                a[pos++] = keys[j]; \
+        if (kept) \
+            *kept = pos; \
+        free(keys); \
+        free(counts); \
+        return true; \
     }
-    else if (!strcmp(algorithm_id, "merge")) {
-        return fossil_sort_merge_stub(base, count, type_size, cmp, desc);
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_LOWCARD)
+
+static bool fossil_sort_lowcard_kind(
+    void *base, size_t count, fossil_sort_kind_t kind, bool desc, size_t *kept)
+{
+    if (count < FOSSIL_SORT_LOWCARD_MIN_COUNT)
+        return false;
+
+    switch (kind) {
+#define FOSSIL_SORT_CASE_LOWCARD(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        return fossil_lowcard_sample_##SUFFIX((const T *)base, count) && \
+               fossil_lowcard_sort_##SUFFIX((T *)base, count, desc, kept);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_LOWCARD)
+#undef FOSSIL_SORT_CASE_LOWCARD
+    default:
+        return false;
     }
-    else if (!strcmp(algorithm_id, "heap")) {
-        return fossil_sort_heap_stub(base, count, type_size, cmp, desc);
+}
+
+// Counting sort over the full 8-bit domain; signed kinds are biased so the
+// histogram walks values in order.
+#define FOSSIL_SORT_DEFINE_COUNTING8(SUFFIX, T) \
+    static void fossil_counting_sort_##SUFFIX(T *a, size_t n, bool desc, size_t *kept) \
+    { \
+        size_t hist[256] = {0}; \
+        const unsigned bias = ((T)-1 < 0) ? 0x80u : 0u; \
+        for (size_t i = 0; i < n; ++i) \
+            hist[(uint8_t)a[i] ^ bias]++; \
+        size_t pos = 0; \
+        for (unsigned v = 0; v < 256; ++v) { \
+            unsigned idx = desc ? 255u - v : v; \
+            if (hist[idx]) { \
+                size_t run = kept ? 1 : hist[idx]; \
+                memset(a + pos, (int)(idx ^ bias), run); \
+                pos += run; \
+            } \
+        } \
+        if (kept) \
+            *kept = pos; \
     }
-    else if (!strcmp(algorithm_id, "insertion")) {
-        return fossil_sort_insertion_stub(base, count, type_size, cmp, desc);
+
+FOSSIL_SORT_DEFINE_COUNTING8(i8,   int8_t)
+FOSSIL_SORT_DEFINE_COUNTING8(u8,   uint8_t)
+FOSSIL_SORT_DEFINE_COUNTING8(char, char)
+
+// With kept != NULL every engine below drops duplicates while writing its
+// output and reports how many distinct keys remain at the front.
+static bool fossil_sort_counting8_kind(
+    void *base, size_t count, fossil_sort_kind_t kind, bool desc, size_t *kept)
+{
+    switch (kind) {
+    case FOSSIL_SORT_KIND_I8:   fossil_counting_sort_i8((int8_t *)base, count, desc, kept); return true;
+    case FOSSIL_SORT_KIND_U8:   fossil_counting_sort_u8((uint8_t *)base, count, desc, kept); return true;
+    case FOSSIL_SORT_KIND_CHAR: fossil_counting_sort_char((char *)base, count, desc, kept); return true;
+    default:                    return false;
     }
-    else if (!strcmp(algorithm_id, "shell")) {
-        return fossil_sort_shell_stub(base, count, type_size, cmp, desc);
+}
+
+// Key-range narrowing
+//
+// Wide integer keys often span a small range (timestamps inside one day,
+// ids from one shard). A min/max pre-scan measures that range; keys are then
+// rebased against the minimum into a u16 or u32 scratch array, sorted by an
+// LSD byte radix that only runs the passes the range needs, and widened back.
+// Ranges shorter than the input go straight to a counting histogram.
+
+#define FOSSIL_SORT_NARROW_MIN_COUNT    256
+#define FOSSIL_SORT_COUNTING_RANGE_MAX  65536u
+
+typedef enum {
+    FOSSIL_SORT_NARROW_AUTO,     // only when a narrower key type is reached
+    FOSSIL_SORT_NARROW_COUNTING, // only when the range fits a histogram
+    FOSSIL_SORT_NARROW_RADIX     // always; full-width radix as a last resort
+} fossil_sort_narrow_mode_t;
+
+static unsigned fossil_sort_range_bytes(uint64_t range)
+{
+    unsigned bytes = 0;
+    while (range) {
+        range >>= 8;
+        ++bytes;
     }
-    else if (!strcmp(algorithm_id, "bubble")) {
-        return fossil_sort_bubble_stub(base, count, type_size, cmp, desc);
+    return bytes;
+}
+
+// LSD byte radix over the low `bytes` bytes. Passes whose byte is the same
+// for every key are skipped. Returns the buffer holding the sorted keys.
+#define FOSSIL_SORT_DEFINE_RADIX(SUFFIX, U) \
+    static U *fossil_radix_sort_##SUFFIX(U *a, U *tmp, size_t n, unsigned bytes) \
+    { \
+        size_t hist[256]; \
+        for (unsigned b = 0; b < bytes; ++b) { \
+            unsigned shift = 8u * b; \
+            memset(hist, 0, sizeof(hist)); \
+            for (size_t i = 0; i < n; ++i) \
+                hist[(a[i] >> shift) & 0xFFu]++; \
+            if (hist[(a[0] >> shift) & 0xFFu] == n) \
+                continue; \
+            size_t sum = 0; \
+            for (unsigned d = 0; d < 256; ++d) { \
+                size_t c = hist[d]; \
+                hist[d] = sum; \
+                sum += c; \
+            } \
+            for (size_t i = 0; i < n; ++i) \
+                tmp[hist[(a[i] >> shift) & 0xFFu]++] = a[i]; \
+            U *swap = a; \
+            a = tmp; \
+            tmp = swap; \
+        } \
+        return a; \
+    }
+
+FOSSIL_SORT_DEFINE_RADIX(u16, uint16_t)
+FOSSIL_SORT_DEFINE_RADIX(u32, uint32_t)
+FOSSIL_SORT_DEFINE_RADIX(u64, uint64_t)
+
+// Rebases a[] into U scratch, radix sorts it, and widens back in order.
+#define FOSSIL_SORT_REBASE_RADIX(T, U, SUFFIX) \
+    do { \
+        U *keys = malloc(2 * n * sizeof(U)); \
+        if (!keys) \
+            return false; \
+        for (size_t i = 0; i < n; ++i) \
+            keys[i] = (U)((uint64_t)a[i] - base); \
+        const U *sorted = fossil_radix_sort_##SUFFIX(keys, keys + n, n, bytes); \
+        size_t w = 0; \
+        for (size_t i = 0; i < n; ++i) { \
+            U key = sorted[desc ? n - 1 - i : i]; \
+            a[w] = (T)(base + key); \
+            w += !kept || w == 0 || key != sorted[desc ? n - i : i - 1]; \
+        } \
+        if (kept) \
+            *kept = w; \
+        free(keys); \
+    } while (0)
+
+#define FOSSIL_SORT_DEFINE_NARROW(SUFFIX, T) \
+    static void fossil_sort_minmax_##SUFFIX(const T *a, size_t n, T *lo, T *hi) \
+    { \
+        T lo0 = a[0], lo1 = a[0], hi0 = a[0], hi1 = a[0]; \
+        size_t i = 1; \
+        for (; i + 2 <= n; i += 2) { \
+            T x = a[i], y = a[i + 1]; \
+            lo0 = x < lo0 ? x : lo0; \
+            hi0 = x > hi0 ? x : hi0; \
+            lo1 = y < lo1 ? y : lo1; \
+            hi1 = y > hi1 ? y : hi1; \
+        } \
+        if (i < n) { \
+            lo0 = a[i] < lo0 ? a[i] : lo0; \
+            hi0 = a[i] > hi0 ? a[i] : hi0; \
+        } \
+        *lo = lo0 < lo1 ? lo0 : lo1; \
+        *hi = hi0 > hi1 ? hi0 : hi1; \
+    } \
+    static bool fossil_sort_narrow_##SUFFIX( \
+        T *a, size_t n, bool desc, fossil_sort_narrow_mode_t mode, size_t *kept) \
+    { \
+        T lo, hi; \
+        fossil_sort_minmax_##SUFFIX(a, n, &lo, &hi); \
+        uint64_t base = (uint64_t)lo; \
+        uint64_t range = (uint64_t)hi - base; \
+        if (range == 0) { \
+            if (kept) \
+                *kept = 1; \
+            return true; \
+        } \
+        if (range < FOSSIL_SORT_COUNTING_RANGE_MAX && \
+            (range < n || mode == FOSSIL_SORT_NARROW_COUNTING)) { \
+            size_t *hist = calloc((size_t)range + 1, sizeof(size_t)); \
+            if (!hist) \
+                return false; \
+            for (size_t i = 0; i < n; ++i) \
+                hist[(uint64_t)a[i] - base]++; \
+            size_t pos = 0; \
+            for (size_t v = 0; v <= (size_t)range; ++v) { \
+                size_t idx = desc ? (size_t)range - v : v; \
+                T x = (T)(base + idx); \
+                for (size_t c = kept && hist[idx] ? 1 : hist[idx]; c > 0; --c) \
+                    a[pos++] = x; \
+            } \
+            if (kept) \
+                *kept = pos; \
+            free(hist); \
+            return true; \
+        } \
+        if (mode == FOSSIL_SORT_NARROW_COUNTING) \
+            return false; \
+        unsigned bytes = fossil_sort_range_bytes(range); \
+        if (mode == FOSSIL_SORT_NARROW_AUTO && bytes >= sizeof(T)) \
+            return false; \
+        if (bytes <= 2) \
+            FOSSIL_SORT_REBASE_RADIX(T, uint16_t, u16); \
+        else if (bytes <= 4) \
+            FOSSIL_SORT_REBASE_RADIX(T, uint32_t, u32); \
+        else \
+            FOSSIL_SORT_REBASE_RADIX(T, uint64_t, u64); \
+        return true; \
+    }
+
+FOSSIL_SORT_DEFINE_NARROW(i16, int16_t)
+FOSSIL_SORT_DEFINE_NARROW(i32, int32_t)
+FOSSIL_SORT_DEFINE_NARROW(i64, int64_t)
+FOSSIL_SORT_DEFINE_NARROW(u16, uint16_t)
+FOSSIL_SORT_DEFINE_NARROW(u32, uint32_t)
+FOSSIL_SORT_DEFINE_NARROW(u64, uint64_t)
+
+static bool fossil_sort_narrow_kind(
+    void *base, size_t count, fossil_sort_kind_t kind, bool desc, fossil_sort_narrow_mode_t mode, size_t *kept)
+{
+    switch (kind) {
+    case FOSSIL_SORT_KIND_I16: return fossil_sort_narrow_i16((int16_t *)base, count, desc, mode, kept);
+    case FOSSIL_SORT_KIND_I32: return fossil_sort_narrow_i32((int32_t *)base, count, desc, mode, kept);
+    case FOSSIL_SORT_KIND_I64: return fossil_sort_narrow_i64((int64_t *)base, count, desc, mode, kept);
+    case FOSSIL_SORT_KIND_U16: return fossil_sort_narrow_u16((uint16_t *)base, count, desc, mode, kept);
+    case FOSSIL_SORT_KIND_U32: return fossil_sort_narrow_u32((uint32_t *)base, count, desc, mode, kept);
+    case FOSSIL_SORT_KIND_U64: return fossil_sort_narrow_u64((uint64_t *)base, count, desc, mode, kept);
+    default:                   return false;
+    }
+}
+
+// Unique: drops adjacent duplicates from a sorted array, keeping the first
+// of each run. The typed loop stores every element and only advances the
+// write cursor on a new key. With out == NULL it only counts.
+#define FOSSIL_SORT_DEFINE_UNIQUE(NAME, SUFFIX, T) \
+    static size_t fossil_unique_##SUFFIX(const T *in, size_t n, T *out) \
+    { \
+        if (n == 0) \
+            return 0; \
+        T last = in[0]; \
+        size_t w = 1; \
+        if (out) { \
+            out[0] = last; \
+            for (size_t i = 1; i < n; ++i) { \
+                T x = in[i]; \
+                out[w] = x; \
+                w += !(x == last); \
+                last = x; \
+            } \
+        } else { \
+            for (size_t i = 1; i < n; ++i) { \
+                w += !(in[i] == last); \
+                last = in[i]; \
+            } \
+        } \
+        return w; \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_UNIQUE)
+
+static size_t fossil_unique_generic(
+    const char *in, size_t n, char *out, size_t type_size, fossil_sort_compare_fn cmp)
+{
+    if (n == 0)
+        return 0;
+    size_t w = 1, last = 0;
+    if (out && out != in)
+        memcpy(out, in, type_size);
+    for (size_t i = 1; i < n; ++i) {
+        if (cmp(in + i * type_size, in + last * type_size, false) == 0)
+            continue;
+        last = i;
+        if (out)
+            memmove(out + w * type_size, in + i * type_size, type_size);
+        ++w;
+    }
+    return w;
+}
+
+static size_t fossil_unique_kind(
+    const void *in, size_t n, void *out, fossil_sort_kind_t kind, size_t type_size, fossil_sort_compare_fn cmp)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_UNIQUE(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_unique_##SUFFIX((const T *)in, n, (T *)out);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_UNIQUE)
+#undef FOSSIL_SORT_CASE_UNIQUE
+    default:
+        return fossil_unique_generic((const char *)in, n, (char *)out, type_size, cmp);
+    }
+}
+
+// Presorted input: returns true once base is sorted. Sorted, reversed and
+// few-run arrays finish with the run scan and a natural merge; a long sorted
+// prefix followed by a short unsorted tail (rows appended since the last
+// sort) has the tail sorted on its own and merged in. Random data exceeds the
+// run budget within a few hundred elements and falls through untouched apart
+// from reversed runs, which is still a permutation the engines accept.
+static bool fossil_sort_natural(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    size_t ends[FOSSIL_SORT_NATURAL_RUNS];
+    size_t runs = fossil_sort_runs_kind(base, count, kind, type_size, cmp, desc, ends, FOSSIL_SORT_NATURAL_RUNS);
+    if (runs == 1)
+        return true;
+    if (runs > FOSSIL_SORT_NATURAL_RUNS) {
+        size_t prefix = ends[0];
+        if (prefix < count - count / 8)
+            return false;
+        char *tail = (char *)base + prefix * type_size;
+        int status = kind == FOSSIL_SORT_KIND_NONE
+            ? fossil_sort_merge_stub(tail, count - prefix, type_size, cmp, desc)
+            : fossil_sort_quick_stub(tail, count - prefix, type_size, kind, cmp, desc);
+        if (status != 0)
+            return false;
+        ends[1] = count;
+        runs = 2;
+    }
+    void *tmp = malloc(count * type_size);
+    if (!tmp)
+        return false;
+    fossil_natural_merge_kind(base, count, ends, runs, tmp, kind, type_size, cmp, desc);
+    free(tmp);
+    return true;
+}
+
+// Auto: picks an engine from the type and a cheap look at the data. With
+// kept != NULL the result is also deduplicated: the distribution engines do
+// it while writing their output, the comparison engines in a final pass.
+static int fossil_sort_auto_dedup(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc,
+    size_t *kept)
+{
+    if (count >= 2 && fossil_sort_natural(base, count, type_size, kind, cmp, desc)) {
+        if (kept)
+            *kept = fossil_unique_kind(base, count, base, kind, type_size, cmp);
+        return 0;
+    }
+
+    // The fused passes group keys by bit pattern, which only matches `==`
+    // for integers: 0.0 and -0.0 must merge and NaN values must not.
+    bool fused = kind != FOSSIL_SORT_KIND_NONE &&
+                 !(kept && (kind == FOSSIL_SORT_KIND_F32 || kind == FOSSIL_SORT_KIND_F64));
+    if (fused && count >= 2) {
+        if (fossil_sort_counting8_kind(base, count, kind, desc, kept))
+            return 0;
+        if (count >= FOSSIL_SORT_NARROW_MIN_COUNT &&
+            fossil_sort_narrow_kind(base, count, kind, desc, FOSSIL_SORT_NARROW_AUTO, kept))
+            return 0;
+        if (fossil_sort_lowcard_kind(base, count, kind, desc, kept))
+            return 0;
+    }
+
+    int status = kind == FOSSIL_SORT_KIND_NONE
+        ? fossil_sort_merge_stub(base, count, type_size, cmp, desc)
+        : fossil_sort_quick_stub(base, count, type_size, kind, cmp, desc);
+    if (status == 0 && kept)
+        *kept = fossil_unique_kind(base, count, base, kind, type_size, cmp);
+    return status;
+}
+
+static int fossil_sort_auto_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (kind != FOSSIL_SORT_KIND_NONE && count < 2)
+        return -10;
+    return fossil_sort_auto_dedup(base, count, type_size, kind, cmp, desc, NULL);
+}
+
+// Bubble Sort
+static int fossil_sort_bubble_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (!base || count < 2 || !cmp || type_size == 0)
+        return -14;
+
+    char *arr = (char *)base;
+    char *tmp = malloc(type_size);
+    if (!tmp) return -14;
+
+    for (size_t i = 0; i < count - 1; ++i) {
+        for (size_t j = 0; j < count - i - 1; ++j) {
+            if (cmp(arr + j * type_size, arr + (j + 1) * type_size, desc) > 0) {
+                memcpy(tmp, arr + j * type_size, type_size);
+                memcpy(arr + j * type_size, arr + (j + 1) * type_size, type_size);
+                memcpy(arr + (j + 1) * type_size, tmp, type_size);
+            }
+        }
+    }
+    free(tmp);
+    return 0;
+}
+
+// Counting Sort (8-bit kinds, or integer keys spanning at most 65536 values)
+static int fossil_sort_counting_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (!base || count < 2 || !cmp || type_size == 0)
+        return -15;
+
+    if (fossil_sort_counting8_kind(base, count, kind, desc, NULL))
+        return 0;
+    if (!fossil_sort_narrow_kind(base, count, kind, desc, FOSSIL_SORT_NARROW_COUNTING, NULL))
+        return -15;
+    return 0;
+}
+
+// Radix Sort (integer kinds, LSD bytes over min-rebased keys)
+static int fossil_sort_radix_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (!base || count < 2 || !cmp || type_size == 0)
+        return -16;
+
+    if (fossil_sort_counting8_kind(base, count, kind, desc, NULL))
+        return 0;
+    if (!fossil_sort_narrow_kind(base, count, kind, desc, FOSSIL_SORT_NARROW_RADIX, NULL))
+        return -16;
+    return 0;
+}
+
+// Flash Sort
+//
+// Keys are mapped through a CDF into about n/8 buckets, scattered into a
+// scratch copy in bucket order, and each bucket is finished in place by a
+// sorting network (introsort if the CDF left a bucket long). Without a
+// caller CDF a piecewise-linear one is fitted to a sorted sample of keys.
+
+#define FOSSIL_FLASH_SAMPLE 1024
+#define FOSSIL_FLASH_KNOTS  64
+
+typedef struct {
+    double knot[FOSSIL_FLASH_KNOTS + 1];
+} fossil_flash_model_t;
+
+static double fossil_flash_sampled_cdf(double value, void *context)
+{
+    const double *k = ((const fossil_flash_model_t *)context)->knot;
+    if (!(value > k[0]))
+        return 0.0;
+    if (value >= k[FOSSIL_FLASH_KNOTS])
+        return 1.0;
+
+    // Invariant: k[lo] <= value < k[hi].
+    size_t lo = 0, hi = FOSSIL_FLASH_KNOTS;
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (k[mid] <= value)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    double frac = (value - k[lo]) / (k[hi] - k[lo]);
+    if (!(frac >= 0.0))
+        frac = 0.0; // infinite knots
+    return ((double)lo + frac) / FOSSIL_FLASH_KNOTS;
+}
+
+#define FOSSIL_SORT_DEFINE_FLASH(NAME, SUFFIX, T) \
+    static void fossil_flash_fit_##SUFFIX(const T *a, size_t n, fossil_flash_model_t *model) \
+    { \
+        double sample[FOSSIL_FLASH_SAMPLE]; \
+        size_t s = n < FOSSIL_FLASH_SAMPLE ? n : FOSSIL_FLASH_SAMPLE; \
+        size_t step = n / s; \
+        for (size_t i = 0; i < s; ++i) \
+            sample[i] = (double)a[i * step]; \
+        fossil_quick_sort_f64(sample, s, false, fossil_quick_depth_limit(s), NULL); \
+        for (size_t k = 0; k <= FOSSIL_FLASH_KNOTS; ++k) \
+            model->knot[k] = sample[k * (s - 1) / FOSSIL_FLASH_KNOTS]; \
+    } \
+    static int fossil_flash_sort_##SUFFIX( \
+        T *a, size_t n, bool desc, fossil_algorithm_sort_cdf_fn cdf, void *context) \
+    { \
+        fossil_flash_model_t model; \
+        if (!cdf) { \
+            fossil_flash_fit_##SUFFIX(a, n, &model); \
+            cdf = fossil_flash_sampled_cdf; \
+            context = &model; \
+        } \
+        size_t m = n / 8 ? n / 8 : 1; \
+        if (m > UINT32_MAX) \
+            m = UINT32_MAX; \
+        uint32_t *slot = malloc(n * sizeof(uint32_t)); \
+        size_t *end = calloc(m + 1, sizeof(size_t)); \
+        T *tmp = malloc(n * sizeof(T)); \
+        if (!slot || !end || !tmp) { \
+            free(slot); \
+            free(end); \
+            free(tmp); \
+            return -5; \
+        } \
+        for (size_t i = 0; i < n; ++i) { \
+            double p = cdf((double)a[i], context); \
+            size_t b = 0; \
+            if (p > 0.0) \
+                b = (size_t)((p < 1.0 ? p : 1.0) * (double)m); \
+            if (b >= m) \
+                b = m - 1; \
+            if (desc) \
+                b = m - 1 - b; \
+            slot[i] = (uint32_t)b; \
+            end[b + 1]++; \
+        } \
+        for (size_t b = 0; b < m; ++b) \
+            end[b + 1] += end[b]; \
+        /* Scattering advances each bucket start to its end. */ \
+        for (size_t i = 0; i < n; ++i) \
+            tmp[end[slot[i]]++] = a[i]; \
+        memcpy(a, tmp, n * sizeof(T)); \
+        size_t lo = 0; \
+        for (size_t b = 0; b < m; ++b) { \
+            size_t len = end[b] - lo; \
+            if (len > FOSSIL_ALGORITHM_SORT_NETWORK_MAX) \
+                fossil_quick_sort_##SUFFIX(a + lo, len, desc, fossil_quick_depth_limit(len), tmp); \
+            else if (len > 1) \
+                fossil_network_sort_##SUFFIX(a + lo, len, desc); \
+            lo = end[b]; \
+        } \
+        free(slot); \
+        free(end); \
+        free(tmp); \
+        return 0; \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_FLASH)
+
+static int fossil_sort_flash_kind(
+    void *base, size_t count, fossil_sort_kind_t kind, bool desc, fossil_algorithm_sort_cdf_fn cdf, void *context)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_FLASH(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_flash_sort_##SUFFIX((T *)base, count, desc, cdf, context);
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_FLASH)
+#undef FOSSIL_SORT_CASE_FLASH
+    default:
+        return -2;
+    }
+}
+
+static int fossil_sort_flash_stub(
+    void *base, size_t count, size_t type_size, fossil_sort_kind_t kind, fossil_sort_compare_fn cmp, bool desc)
+{
+    if (!base || count < 2 || !cmp || type_size == 0)
+        return -18;
+
+    if (fossil_sort_flash_kind(base, count, kind, desc, NULL, NULL) != 0)
+        return -18;
+    return 0;
+}
+
+int fossil_algorithm_sort_flash(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id,
+    fossil_algorithm_sort_cdf_fn cdf,
+    void *context)
+{
+    if (!base || !type_id)
+        return -1;
+
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+    if (kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    if (count < 2)
+        return 0;
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    return fossil_sort_flash_kind(base, count, kind, desc, cdf, context);
+}
+
+// ======================================================
+// Radix / hash partitioning
+// ======================================================
+
+// Order-preserving unsigned image of each key kind: the sign bit of signed
+// integers is flipped, and floats get the usual IEEE total-order transform.
+#define FOSSIL_SORT_DEFINE_KEY_UNSIGNED(SUFFIX, T) \
+    static inline uint64_t fossil_sort_key_##SUFFIX(T v) { return (uint64_t)v; }
+
+#define FOSSIL_SORT_DEFINE_KEY_SIGNED(SUFFIX, T, UT) \
+    static inline uint64_t fossil_sort_key_##SUFFIX(T v) \
+    { \
+        UT u = (UT)v; \
+        if ((T)-1 < 0) \
+            u ^= (UT)((UT)1 << (8 * sizeof(UT) - 1)); \
+        return (uint64_t)u; \
+    }
+
+FOSSIL_SORT_DEFINE_KEY_SIGNED(i8, int8_t, uint8_t)
+FOSSIL_SORT_DEFINE_KEY_SIGNED(i16, int16_t, uint16_t)
+FOSSIL_SORT_DEFINE_KEY_SIGNED(i32, int32_t, uint32_t)
+FOSSIL_SORT_DEFINE_KEY_SIGNED(i64, int64_t, uint64_t)
+FOSSIL_SORT_DEFINE_KEY_SIGNED(char, char, unsigned char)
+FOSSIL_SORT_DEFINE_KEY_UNSIGNED(u8, uint8_t)
+FOSSIL_SORT_DEFINE_KEY_UNSIGNED(u16, uint16_t)
+FOSSIL_SORT_DEFINE_KEY_UNSIGNED(u32, uint32_t)
+FOSSIL_SORT_DEFINE_KEY_UNSIGNED(u64, uint64_t)
+
+static inline uint64_t fossil_sort_key_f32(float v)
+{
+    uint32_t u;
+    memcpy(&u, &v, sizeof(u));
+    return (u & 0x80000000u) ? (uint32_t)~u : (u | 0x80000000u);
+}
+
+static inline uint64_t fossil_sort_key_f64(double v)
+{
+    uint64_t u;
+    memcpy(&u, &v, sizeof(u));
+    return (u & 0x8000000000000000ULL) ? ~u : (u | 0x8000000000000000ULL);
+}
+
+// Bytes per partition write-combining buffer: one cache line.
+#define FOSSIL_PARTITION_WC_BYTES 64
+
+typedef struct {
+    const void *keys;
+    void *keys_out;
+    const unsigned char *payload;
+    unsigned char *payload_out;
+    size_t payload_size;
+    size_t begin, end;
+    fossil_sort_kind_t kind;
+    bool hash;
+    unsigned bits, shift;
+    bool scatter;           // false: histogram pass, true: scatter pass
+    size_t *hist;           // counts, then write cursors
+    unsigned char *wc;      // 2^bits buffers of FOSSIL_PARTITION_WC_BYTES
+    unsigned char *fill;    // elements held per buffer
+} fossil_partition_job_t;
+
+static inline size_t fossil_partition_index(uint64_t key, const fossil_partition_job_t *job)
+{
+    if (job->hash)
+        return job->bits ? (size_t)(fossil_sort_hash_bits(key) >> (64 - job->bits)) : 0;
+    return (size_t)((key >> job->shift) & (((uint64_t)1 << job->bits) - 1));
+}
+
+#define FOSSIL_SORT_DEFINE_PARTITION(NAME, SUFFIX, T) \
+    static void fossil_partition_count_##SUFFIX(fossil_partition_job_t *job) \
+    { \
+        const T *in = (const T *)job->keys; \
+        for (size_t i = job->begin; i < job->end; ++i) \
+            job->hist[fossil_partition_index(fossil_sort_key_##SUFFIX(in[i]), job)]++; \
+    } \
+    static void fossil_partition_scatter_##SUFFIX(fossil_partition_job_t *job) \
+    { \
+        enum { WC = FOSSIL_PARTITION_WC_BYTES / sizeof(T) }; \
+        const T *in = (const T *)job->keys; \
+        T *out = (T *)job->keys_out; \
+        T *wc = (T *)job->wc; \
+        size_t *cur = job->hist; \
+        size_t ps = job->payload_size; \
+        for (size_t i = job->begin; i < job->end; ++i) { \
+            size_t p = fossil_partition_index(fossil_sort_key_##SUFFIX(in[i]), job); \
+            size_t pos = cur[p]++; \
+            if (job->payload) \
+                memcpy(job->payload_out + pos * ps, job->payload + i * ps, ps); \
+            wc[p * WC + job->fill[p]++] = in[i]; \
+            if (job->fill[p] == WC) { \
+                memcpy(out + pos + 1 - WC, wc + p * WC, WC * sizeof(T)); \
+                job->fill[p] = 0; \
+            } \
+        } \
+        size_t parts = (size_t)1 << job->bits; \
+        for (size_t p = 0; p < parts; ++p) { \
+            if (job->fill[p]) { \
+                memcpy(out + cur[p] - job->fill[p], wc + p * WC, job->fill[p] * sizeof(T)); \
+                job->fill[p] = 0; \
+            } \
+        } \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_PARTITION)
+
+static void fossil_partition_worker(void *arg)
+{
+    fossil_partition_job_t *job = (fossil_partition_job_t *)arg;
+    switch (job->kind) {
+#define FOSSIL_SORT_CASE_PARTITION(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        if (job->scatter) \
+            fossil_partition_scatter_##SUFFIX(job); \
+        else \
+            fossil_partition_count_##SUFFIX(job); \
+        break;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_PARTITION)
+#undef FOSSIL_SORT_CASE_PARTITION
+    default:
+        break;
+    }
+}
+
+// Each thread gets at least this many keys; smaller inputs use fewer threads.
+#define FOSSIL_PARTITION_MIN_CHUNK 16384
+
+int fossil_algorithm_sort_partition(
+    const void *base,
+    void *out,
+    size_t count,
+    const char *type_id,
+    const void *payload,
+    void *payload_out,
+    size_t payload_size,
+    const char *method_id,
+    unsigned bits,
+    unsigned shift,
+    size_t *offsets,
+    size_t threads)
+{
+    if (!type_id || !method_id || !offsets || (count > 0 && (!base || !out)) || base == out)
+        return -1;
+    if ((payload == NULL) != (payload_out == NULL) || (payload && payload_size == 0))
+        return -1;
+
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+    if (kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+
+    bool hash;
+    if (!strcmp(method_id, "radix"))
+        hash = false;
+    else if (!strcmp(method_id, "hash"))
+        hash = true;
+    else
+        return -3;
+
+    if (bits > FOSSIL_ALGORITHM_SORT_PARTITION_MAX_BITS || (!hash && shift >= 64))
+        return -4;
+
+    size_t parts = (size_t)1 << bits;
+    if (threads > count / FOSSIL_PARTITION_MIN_CHUNK)
+        threads = count / FOSSIL_PARTITION_MIN_CHUNK;
+    if (threads > FOSSIL_ALGORITHM_MAX_THREADS)
+        threads = FOSSIL_ALGORITHM_MAX_THREADS;
+    if (threads < 1)
+        threads = 1;
+
+    fossil_partition_job_t *jobs = calloc(threads, sizeof(*jobs));
+    if (!jobs)
+        return -5;
+
+    int status = 0;
+    size_t chunk = count / threads;
+    for (size_t t = 0; t < threads; ++t) {
+        fossil_partition_job_t *job = &jobs[t];
+        job->keys = base;
+        job->keys_out = out;
+        job->payload = (const unsigned char *)payload;
+        job->payload_out = (unsigned char *)payload_out;
+        job->payload_size = payload_size;
+        job->begin = t * chunk;
+        job->end = (t + 1 == threads) ? count : (t + 1) * chunk;
+        job->kind = kind;
+        job->hash = hash;
+        job->bits = bits;
+        job->shift = shift;
+        job->hist = calloc(parts, sizeof(size_t));
+        job->wc = malloc(parts * FOSSIL_PARTITION_WC_BYTES);
+        job->fill = calloc(parts, 1);
+        if (!job->hist || !job->wc || !job->fill)
+            status = -5;
+    }
+
+    if (status == 0) {
+        fossil_algorithm_run_parallel(fossil_partition_worker, jobs, sizeof(*jobs), threads);
+
+        // Partition p starts after every smaller partition; inside it each
+        // chunk follows the chunks before it, which keeps the scatter stable.
+        size_t sum = 0;
+        for (size_t p = 0; p < parts; ++p) {
+            offsets[p] = sum;
+            for (size_t t = 0; t < threads; ++t) {
+                size_t c = jobs[t].hist[p];
+                jobs[t].hist[p] = sum;
+                sum += c;
+            }
+        }
+        offsets[parts] = sum;
+
+        for (size_t t = 0; t < threads; ++t)
+            jobs[t].scatter = true;
+        fossil_algorithm_run_parallel(fossil_partition_worker, jobs, sizeof(*jobs), threads);
+    }
+
+    for (size_t t = 0; t < threads; ++t) {
+        free(jobs[t].hist);
+        free(jobs[t].wc);
+        free(jobs[t].fill);
+    }
+    free(jobs);
+    return status;
+}
+
+// ======================================================
+// Algorithm dispatch (all algorithms implemented as stubs)
+// ======================================================
+
+/**
+ * @brief Inputs up to this many elements skip the general engines.
+ */
+#define FOSSIL_SORT_SMALL_MAX 64
+
+// "auto" and "merge" only promise a (stable) sorted result, so the fast path
+// may serve them with insertion sort or a network. Explicit algorithms keep
+// their own behaviour.
+static bool fossil_sort_is_general(const char *algorithm_id)
+{
+    if (!algorithm_id)
+        return true;
+    if (algorithm_id[0] == 'a')
+        return strcmp(algorithm_id, "auto") == 0;
+    if (algorithm_id[0] == 'm')
+        return strcmp(algorithm_id, "merge") == 0;
+    return false;
+}
+
+int fossil_algorithm_sort_exec(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id)
+{
+    if (!base || count == 0 || !type_id)
+        return -1; // invalid input
+
+    bool desc = (order_id && order_id[0] == 'd' && strcmp(order_id, "desc") == 0);
+    bool general = fossil_sort_is_general(algorithm_id);
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+
+    // Small-input fast path: typed kernels on the caller's array, before any
+    // comparator lookup or allocation.
+    if (general && kind != FOSSIL_SORT_KIND_NONE && count <= FOSSIL_SORT_SMALL_MAX) {
+        if (count < 2)
+            return -10;
+        if (!fossil_sort_network_kind(base, count, kind, desc))
+            fossil_sort_insertion_kind(base, count, kind, desc);
+        return 0;
+    }
+
+    size_t type_size = kind != FOSSIL_SORT_KIND_NONE
+        ? fossil_sort_kind_sizeof(kind)
+        : fossil_algorithm_sort_type_sizeof(type_id);
+    if (type_size == 0)
+        return -2; // unknown type
+
+    fossil_sort_compare_fn cmp = fossil_sort_select_comparator(type_id);
+    if (!cmp)
+        return -2;
+
+    // Generic types take the same shortcut through the comparator.
+    if (general && count <= FOSSIL_SORT_SMALL_MAX && count >= 2 && type_size <= FOSSIL_SORT_ELEM_MAX) {
+        fossil_insertion_sort_generic((char *)base, count, type_size, cmp, desc);
+        return 0;
+    }
+
+    // Dispatch to algorithm
+    if (!algorithm_id || !strcmp(algorithm_id, "auto"))
+    {
+        return fossil_sort_auto_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "merge")) {
+        return fossil_sort_merge_stub(base, count, type_size, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "quick")) {
+        return fossil_sort_quick_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "flash")) {
+        return fossil_sort_flash_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "heap")) {
+        return fossil_sort_heap_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "insertion")) {
+        return fossil_sort_insertion_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "shell")) {
+        return fossil_sort_shell_stub(base, count, type_size, kind, cmp, desc);
+    }
+    else if (!strcmp(algorithm_id, "bubble")) {
+        return fossil_sort_bubble_stub(base, count, type_size, cmp, desc);
     }
     else if (!strcmp(algorithm_id, "counting")) {
-        return fossil_sort_counting_stub(base, count, type_size, cmp, desc);
+        return fossil_sort_counting_stub(base, count, type_size, kind, cmp, desc);
     }
     else if (!strcmp(algorithm_id, "radix")) {
-        return fossil_sort_radix_stub(base, count, type_size, cmp, desc);
+        return fossil_sort_radix_stub(base, count, type_size, kind, cmp, desc);
     }
 
     return -3; // unknown algorithm
 }
+
+// ======================================================
+// Unique and run-length encoding
+// ======================================================
+
+// Resolves a type_id for the sorted-run helpers. Returns 0 or -2.
+static int fossil_sort_resolve_type(
+    const char *type_id, fossil_sort_kind_t *kind, size_t *type_size, fossil_sort_compare_fn *cmp)
+{
+    *kind = fossil_sort_select_kind(type_id);
+    *type_size = *kind != FOSSIL_SORT_KIND_NONE
+        ? fossil_sort_kind_sizeof(*kind)
+        : fossil_algorithm_sort_type_sizeof(type_id);
+    *cmp = fossil_sort_select_comparator(type_id);
+    return (*type_size == 0 || *type_size > FOSSIL_SORT_ELEM_MAX || !*cmp) ? -2 : 0;
+}
+
+int fossil_algorithm_sort_unique(
+    void *base,
+    size_t count,
+    const char *type_id,
+    size_t *unique_count)
+{
+    if ((count > 0 && !base) || !type_id || !unique_count)
+        return -1;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return -2;
+
+    *unique_count = fossil_unique_kind(base, count, base, kind, type_size, cmp);
+    return 0;
+}
+
+int fossil_algorithm_sort_unique_count(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    size_t *unique_count)
+{
+    if ((count > 0 && !base) || !type_id || !unique_count)
+        return -1;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return -2;
+
+    *unique_count = fossil_unique_kind(base, count, NULL, kind, type_size, cmp);
+    return 0;
+}
+
+int fossil_algorithm_sort_exec_unique(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const char *algorithm_id,
+    const char *order_id,
+    size_t *unique_count)
+{
+    if ((count > 0 && !base) || !type_id || !unique_count)
+        return -1;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return -2;
+
+    if (count < 2) {
+        *unique_count = count;
+        return 0;
+    }
+
+    // "auto" fuses the dedup into the engine's output pass when it can.
+    if ((!algorithm_id || !strcmp(algorithm_id, "auto")) && count > FOSSIL_SORT_SMALL_MAX) {
+        bool desc = (order_id && strcmp(order_id, "desc") == 0);
+        return fossil_sort_auto_dedup(base, count, type_size, kind, cmp, desc, unique_count);
+    }
+
+    int status = fossil_algorithm_sort_exec(base, count, type_id, algorithm_id, order_id);
+    if (status != 0)
+        return status;
+    *unique_count = fossil_unique_kind(base, count, base, kind, type_size, cmp);
+    return 0;
+}
+
+// Run boundaries use the same equality as unique: typed == for native kinds,
+// the comparator otherwise.
+#define FOSSIL_SORT_DEFINE_RLE(NAME, SUFFIX, T) \
+    static size_t fossil_rle_encode_##SUFFIX(const T *in, size_t n, T *values, size_t *lengths) \
+    { \
+        size_t runs = 0, start = 0; \
+        for (size_t i = 1; i <= n; ++i) { \
+            if (i < n && in[i] == in[start]) \
+                continue; \
+            if (values) \
+                values[runs] = in[start]; \
+            if (lengths) \
+                lengths[runs] = i - start; \
+            ++runs; \
+            start = i; \
+        } \
+        return runs; \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_RLE)
+
+static size_t fossil_rle_encode_generic(
+    const char *in, size_t n, char *values, size_t *lengths, size_t type_size, fossil_sort_compare_fn cmp)
+{
+    size_t runs = 0, start = 0;
+    for (size_t i = 1; i <= n; ++i) {
+        if (i < n && cmp(in + i * type_size, in + start * type_size, false) == 0)
+            continue;
+        if (values)
+            memcpy(values + runs * type_size, in + start * type_size, type_size);
+        if (lengths)
+            lengths[runs] = i - start;
+        ++runs;
+        start = i;
+    }
+    return runs;
+}
+
+int fossil_algorithm_sort_rle_encode(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    void *values,
+    size_t *lengths,
+    size_t *run_count)
+{
+    if ((count > 0 && !base) || !type_id || !run_count)
+        return -1;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return -2;
+
+    switch (kind) {
+#define FOSSIL_SORT_CASE_RLE(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        *run_count = fossil_rle_encode_##SUFFIX((const T *)base, count, (T *)values, lengths); \
+        return 0;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_RLE)
+#undef FOSSIL_SORT_CASE_RLE
+    default:
+        break;
+    }
+
+    *run_count = fossil_rle_encode_generic((const char *)base, count, (char *)values, lengths, type_size, cmp);
+    return 0;
+}
+
+int fossil_algorithm_sort_rle_decode(
+    const void *values,
+    const size_t *lengths,
+    size_t run_count,
+    const char *type_id,
+    void *out,
+    size_t capacity,
+    size_t *out_count)
+{
+    if ((run_count > 0 && (!values || !lengths)) || !type_id || !out_count)
+        return -1;
+
+    size_t type_size = fossil_algorithm_sort_type_sizeof(type_id);
+    if (type_size == 0)
+        return -2;
+
+    size_t total = 0;
+    for (size_t r = 0; r < run_count; ++r) {
+        if (lengths[r] > SIZE_MAX - total)
+            return -4;
+        total += lengths[r];
+    }
+    *out_count = total;
+    if (!out)
+        return 0;
+    if (total > capacity)
+        return -4;
+
+    // Each run is seeded with one element and then doubled with memcpy.
+    char *dst = (char *)out;
+    const char *src = (const char *)values;
+    for (size_t r = 0; r < run_count; ++r) {
+        size_t len = lengths[r];
+        if (len == 0)
+            continue;
+        memcpy(dst, src + r * type_size, type_size);
+        size_t filled = 1;
+        while (filled < len) {
+            size_t chunk = filled < len - filled ? filled : len - filled;
+            memcpy(dst + filled * type_size, dst, chunk * type_size);
+            filled += chunk;
+        }
+        dst += len * type_size;
+    }
+    return 0;
+}
+
+// ======================================================
+// Group-by aggregation
+// ======================================================
+//
+// Keys group by bit pattern and groups come out in ascending key order
+// ("desc" reverses the result at the end). Three strategies:
+//   - direct: integer keys whose range is smaller than the input aggregate
+//     straight into a table indexed by key - min;
+//   - hash: when a sample says the keys are low-cardinality, one hash table
+//     over the whole input (bails out past FOSSIL_SORT_LOWCARD_MAX groups);
+//   - partitioned: MSD radix partitioning on the order-preserving key image,
+//     FOSSIL_GROUP_RADIX_BITS per level with the values carried as payload,
+//     until a partition fits a small hash table. Partitions come out in key
+//     order, so each leaf only sorts its own (few) distinct keys.
+
+#define FOSSIL_GROUP_LEAF       4096
+#define FOSSIL_GROUP_RADIX_BITS 8
+
+typedef double (*fossil_group_load_fn)(const void *values, size_t i);
+
+static inline void fossil_group_add(
+    fossil_algorithm_sort_group_t *g, const void *values, fossil_group_load_fn load, size_t i)
+{
+    if (values) {
+        double v = load(values, i);
+        if (g->count == 0 || v < g->min)
+            g->min = v;
+        if (g->count == 0 || v > g->max)
+            g->max = v;
+        g->sum += v;
+    }
+    g->count++;
+}
+
+#define FOSSIL_SORT_DEFINE_GROUP(NAME, SUFFIX, T) \
+    static double fossil_group_load_##SUFFIX(const void *values, size_t i) \
+    { \
+        return (double)((const T *)values)[i]; \
+    } \
+    static uint64_t fossil_group_span_##SUFFIX(const T *keys, size_t n) \
+    { \
+        uint64_t first = fossil_sort_key_##SUFFIX(keys[0]), diff = 0; \
+        for (size_t i = 1; i < n; ++i) \
+            diff |= fossil_sort_key_##SUFFIX(keys[i]) ^ first; \
+        return diff; \
+    } \
+    static int fossil_group_direct_##SUFFIX( \
+        const T *keys, const void *values, fossil_group_load_fn load, size_t n, \
+        T *out_keys, fossil_algorithm_sort_group_t *out, size_t *groups) \
+    { \
+        if ((T)0.5 != (T)0) \
+            return 0; \
+        T lo = keys[0], hi = keys[0]; \
+        for (size_t i = 1; i < n; ++i) { \
+            lo = keys[i] < lo ? keys[i] : lo; \
+            hi = keys[i] > hi ? keys[i] : hi; \
+        } \
+        uint64_t range = (uint64_t)hi - (uint64_t)lo; \
+        if (range >= FOSSIL_SORT_COUNTING_RANGE_MAX || range >= n) \
+            return 0; \
+        fossil_algorithm_sort_group_t *slots = calloc((size_t)range + 1, sizeof(*slots)); \
+        if (!slots) \
+            return -5; \
+        for (size_t i = 0; i < n; ++i) \
+            fossil_group_add(&slots[(size_t)((uint64_t)keys[i] - (uint64_t)lo)], values, load, i); \
+        size_t k = 0; \
+        for (size_t s = 0; s <= (size_t)range; ++s) { \
+            if (slots[s].count) { \
+                out_keys[k] = (T)((uint64_t)lo + s); \
+                out[k++] = slots[s]; \
+            } \
+        } \
+        *groups = k; \
+        free(slots); \
+        return 1; \
+    } \
+    static size_t fossil_group_hash_##SUFFIX( \
+        const T *keys, const void *values, fossil_group_load_fn load, size_t n, size_t limit, \
+        T *table_keys, fossil_algorithm_sort_group_t *table, \
+        T *out_keys, fossil_algorithm_sort_group_t *out) \
+    { \
+        size_t cap = 16; \
+        while (cap < 2 * (n < limit ? n : limit)) \
+            cap <<= 1; \
+        memset(table, 0, cap * sizeof(*table)); \
+        size_t distinct = 0; \
+        for (size_t i = 0; i < n; ++i) { \
+            uint64_t bits = 0, other = 0; \
+            memcpy(&bits, &keys[i], sizeof(T)); \
+            size_t h = (size_t)fossil_sort_hash_bits(bits) & (cap - 1); \
+            while (table[h].count) { \
+                memcpy(&other, &table_keys[h], sizeof(T)); \
+                if (other == bits) break; \
+                h = (h + 1) & (cap - 1); \
+            } \
+            if (!table[h].count) { \
+                if (++distinct > cap / 2) \
+                    return SIZE_MAX; \
+                table_keys[h] = keys[i]; \
+            } \
+            fossil_group_add(&table[h], values, load, i); \
+        } \
+        size_t k = 0; \
+        for (size_t h = 0; h < cap; ++h) { \
+            if (table[h].count) { \
+                out_keys[k] = table_keys[h]; \
+                out[k++] = table[h]; \
+            } \
+        } \
+        for (size_t g = fossil_shell_first_gap(k) + 1; g-- > 0;) { \
+            size_t gap = fossil_shell_gaps[g]; \
+            for (size_t i = gap; i < k; ++i) { \
+                T x = out_keys[i]; \
+                fossil_algorithm_sort_group_t agg = out[i]; \
+                uint64_t key = fossil_sort_key_##SUFFIX(x); \
+                size_t j = i; \
+                while (j >= gap && fossil_sort_key_##SUFFIX(out_keys[j - gap]) > key) { \
+                    out_keys[j] = out_keys[j - gap]; \
+                    out[j] = out[j - gap]; \
+                    j -= gap; \
+                } \
+                out_keys[j] = x; \
+                out[j] = agg; \
+            } \
+        } \
+        return k; \
+    }
+
+FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_DEFINE_GROUP)
+
+static fossil_group_load_fn fossil_group_select_load(fossil_sort_kind_t kind)
+{
+    switch (kind) {
+#define FOSSIL_SORT_CASE_GROUP_LOAD(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: return fossil_group_load_##SUFFIX;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_GROUP_LOAD)
+#undef FOSSIL_SORT_CASE_GROUP_LOAD
+    default:
+        return NULL;
+    }
+}
+
+typedef struct {
+    const char *type_id;
+    fossil_sort_kind_t kind;
+    size_t key_size;
+    size_t value_size;
+    fossil_group_load_fn load;
+    unsigned char *keys[2];          // ping-pong partition scratch
+    unsigned char *values[2];
+    void *table_keys;                // 2 * FOSSIL_GROUP_LEAF slots
+    fossil_algorithm_sort_group_t *table;
+    unsigned char *out_keys;
+    fossil_algorithm_sort_group_t *out;
+    size_t groups;
+} fossil_group_ctx_t;
+
+// Aggregates n rows with one hash table and appends the groups to the
+// output. Returns false if more than `limit` distinct keys turn up.
+static bool fossil_group_leaf(
+    fossil_group_ctx_t *ctx, const void *keys, const void *values, size_t n, size_t limit)
+{
+    size_t k = SIZE_MAX;
+    switch (ctx->kind) {
+#define FOSSIL_SORT_CASE_GROUP_HASH(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        k = fossil_group_hash_##SUFFIX((const T *)keys, values, ctx->load, n, limit, \
+                                       (T *)ctx->table_keys, ctx->table, \
+                                       (T *)ctx->out_keys + ctx->groups, ctx->out + ctx->groups); \
+        break;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_GROUP_HASH)
+#undef FOSSIL_SORT_CASE_GROUP_HASH
+    default:
+        break;
+    }
+    if (k == SIZE_MAX)
+        return false;
+    ctx->groups += k;
+    return true;
+}
+
+// Partitions rows [begin, begin + n) on key bits [top - RADIX_BITS, top)
+// into scratch buffer `side` and recurses into each partition with the
+// other buffer as destination. Leaves that still exceed FOSSIL_GROUP_LEAF
+// once every key bit is used hold a single key.
+static int fossil_group_partitioned(
+    fossil_group_ctx_t *ctx, const unsigned char *keys, const unsigned char *values,
+    size_t begin, size_t n, unsigned top, unsigned side)
+{
+    if (n <= FOSSIL_GROUP_LEAF || top == 0) {
+        fossil_group_leaf(ctx, keys, values, n, FOSSIL_GROUP_LEAF);
+        return 0;
+    }
+
+    unsigned bits = top < FOSSIL_GROUP_RADIX_BITS ? top : FOSSIL_GROUP_RADIX_BITS;
+    unsigned shift = top - bits;
+    size_t offsets[(1u << FOSSIL_GROUP_RADIX_BITS) + 1];
+    unsigned char *dk = ctx->keys[side] + begin * ctx->key_size;
+    unsigned char *dv = values ? ctx->values[side] + begin * ctx->value_size : NULL;
+
+    int status = fossil_algorithm_sort_partition(
+        keys, dk, n, ctx->type_id, values, dv, ctx->value_size, "radix", bits, shift, offsets, 1);
+    if (status != 0)
+        return status;
+
+    for (size_t p = 0; p < ((size_t)1 << bits) && status == 0; ++p) {
+        size_t len = offsets[p + 1] - offsets[p];
+        if (len == 0)
+            continue;
+        status = fossil_group_partitioned(
+            ctx, dk + offsets[p] * ctx->key_size,
+            dv ? dv + offsets[p] * ctx->value_size : NULL,
+            begin + offsets[p], len, shift, side ^ 1u);
+    }
+    return status;
+}
+
+static unsigned fossil_group_top_bit(uint64_t diff)
+{
+    unsigned top = 0;
+    while (diff) {
+        diff >>= 1;
+        ++top;
+    }
+    return top;
+}
+
+int fossil_algorithm_sort_group_by(
+    const void *keys,
+    const void *values,
+    size_t count,
+    const char *key_type_id,
+    const char *value_type_id,
+    const char *order_id,
+    void *out_keys,
+    fossil_algorithm_sort_group_t *out_groups,
+    size_t *group_count)
+{
+    if (!key_type_id || !group_count || (values && !value_type_id))
+        return -1;
+    if (count > 0 && (!keys || !out_keys || !out_groups))
+        return -1;
+
+    fossil_group_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.type_id = key_type_id;
+    ctx.kind = fossil_sort_select_kind(key_type_id);
+    if (ctx.kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    ctx.key_size = fossil_sort_kind_sizeof(ctx.kind);
+    if (values) {
+        fossil_sort_kind_t value_kind = fossil_sort_select_kind(value_type_id);
+        ctx.load = fossil_group_select_load(value_kind);
+        if (!ctx.load)
+            return -2;
+        ctx.value_size = fossil_sort_kind_sizeof(value_kind);
+    }
+    ctx.out_keys = (unsigned char *)out_keys;
+    ctx.out = out_groups;
+
+    *group_count = 0;
+    if (count == 0)
+        return 0;
+
+    int direct = 0;
+    uint64_t span = 0;
+    bool lowcard = false;
+    switch (ctx.kind) {
+#define FOSSIL_SORT_CASE_GROUP_PLAN(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        direct = fossil_group_direct_##SUFFIX((const T *)keys, values, ctx.load, count, \
+                                              (T *)out_keys, out_groups, &ctx.groups); \
+        if (direct == 0) { \
+            span = fossil_group_span_##SUFFIX((const T *)keys, count); \
+            lowcard = count >= FOSSIL_SORT_LOWCARD_MIN_COUNT && \
+                      fossil_lowcard_sample_##SUFFIX((const T *)keys, count); \
+        } \
+        break;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_GROUP_PLAN)
+#undef FOSSIL_SORT_CASE_GROUP_PLAN
+    default:
+        break;
+    }
+    if (direct < 0)
+        return direct;
+
+    int status = 0;
+    if (direct == 0) {
+        ctx.table_keys = malloc(2 * FOSSIL_GROUP_LEAF * ctx.key_size);
+        ctx.table = malloc(2 * FOSSIL_GROUP_LEAF * sizeof(*ctx.table));
+        if (!ctx.table_keys || !ctx.table)
+            status = -5;
+
+        if (status == 0 && !(lowcard && fossil_group_leaf(&ctx, keys, values, count, FOSSIL_SORT_LOWCARD_MAX))) {
+            ctx.groups = 0;
+            if (count > FOSSIL_GROUP_LEAF && span != 0) {
+                ctx.keys[0] = malloc(count * ctx.key_size);
+                ctx.keys[1] = malloc(count * ctx.key_size);
+                if (values) {
+                    ctx.values[0] = malloc(count * ctx.value_size);
+                    ctx.values[1] = malloc(count * ctx.value_size);
+                }
+                if (!ctx.keys[0] || !ctx.keys[1] || (values && (!ctx.values[0] || !ctx.values[1])))
+                    status = -5;
+            }
+            if (status == 0)
+                status = fossil_group_partitioned(&ctx, (const unsigned char *)keys,
+                                                  (const unsigned char *)values, 0, count,
+                                                  fossil_group_top_bit(span), 0);
+        }
+
+        free(ctx.keys[0]);
+        free(ctx.keys[1]);
+        free(ctx.values[0]);
+        free(ctx.values[1]);
+        free(ctx.table_keys);
+        free(ctx.table);
+        if (status != 0)
+            return status;
+    }
+
+    if (order_id && strcmp(order_id, "desc") == 0 && ctx.groups > 1) {
+        unsigned char tmp[FOSSIL_SORT_ELEM_MAX];
+        for (size_t i = 0, j = ctx.groups - 1; i < j; ++i, --j) {
+            fossil_algorithm_sort_group_t g = out_groups[i];
+            out_groups[i] = out_groups[j];
+            out_groups[j] = g;
+            memcpy(tmp, ctx.out_keys + i * ctx.key_size, ctx.key_size);
+            memcpy(ctx.out_keys + i * ctx.key_size, ctx.out_keys + j * ctx.key_size, ctx.key_size);
+            memcpy(ctx.out_keys + j * ctx.key_size, tmp, ctx.key_size);
+        }
+    }
+    *group_count = ctx.groups;
+    return 0;
+}
+
+// ======================================================
+// Selection and exact quantiles
+// ======================================================
+
+// Returns a sorted, deduplicated copy of the ranks (NULL when out of memory).
+static size_t *fossil_select_prepare_ranks(const size_t *ranks, size_t rank_count, size_t *kept)
+{
+    size_t *sorted = malloc(rank_count * sizeof(size_t));
+    if (!sorted)
+        return NULL;
+    memcpy(sorted, ranks, rank_count * sizeof(size_t));
+    if (rank_count > 1)
+        fossil_algorithm_sort_exec(sorted, rank_count, "size", "auto", "asc");
+    size_t k = 0;
+    for (size_t i = 0; i < rank_count; ++i)
+        if (k == 0 || sorted[i] != sorted[k - 1])
+            sorted[k++] = sorted[i];
+    *kept = k;
+    return sorted;
+}
+
+static int fossil_select_kind(
+    void *base, size_t count, fossil_sort_kind_t kind, size_t type_size,
+    const size_t *ranks, size_t rank_count, bool desc)
+{
+    size_t m = 0;
+    size_t *sorted = fossil_select_prepare_ranks(ranks, rank_count, &m);
+    void *scratch = malloc(count * type_size);
+    if (!sorted) {
+        free(scratch);
+        return -5;
+    }
+
+    // Without scratch the partition runs in place.
+    unsigned depth = fossil_quick_depth_limit(count);
+    switch (kind) {
+#define FOSSIL_SORT_CASE_SELECT(NAME, SUFFIX, T) \
+    case FOSSIL_SORT_KIND_##NAME: \
+        fossil_select_many_##SUFFIX((T *)base, count, 0, sorted, m, desc, depth, (T *)scratch); \
+        break;
+    FOSSIL_SORT_FOREACH_KIND(FOSSIL_SORT_CASE_SELECT)
+#undef FOSSIL_SORT_CASE_SELECT
+    default:
+        break;
+    }
+    free(scratch);
+    free(sorted);
+    return 0;
+}
+
+int fossil_algorithm_sort_select(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const size_t *ranks,
+    size_t rank_count,
+    const char *order_id)
+{
+    if (!type_id || (count > 0 && !base) || (rank_count > 0 && !ranks))
+        return -1;
+
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+    if (kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    for (size_t i = 0; i < rank_count; ++i)
+        if (ranks[i] >= count)
+            return -4;
+    if (rank_count == 0 || count < 2)
+        return 0;
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    return fossil_select_kind(base, count, kind, fossil_sort_kind_sizeof(kind), ranks, rank_count, desc);
+}
+
+int fossil_algorithm_sort_quantiles(
+    void *base,
+    size_t count,
+    const char *type_id,
+    const double *qs,
+    size_t q_count,
+    void *out,
+    bool in_place)
+{
+    if (!type_id || (count > 0 && !base) || (q_count > 0 && (!qs || !out)))
+        return -1;
+
+    fossil_sort_kind_t kind = fossil_sort_select_kind(type_id);
+    if (kind == FOSSIL_SORT_KIND_NONE)
+        return -2;
+    for (size_t i = 0; i < q_count; ++i)
+        if (!(qs[i] >= 0.0 && qs[i] <= 1.0))
+            return -4;
+    if (q_count == 0)
+        return 0;
+    if (count == 0)
+        return -4;
+
+    size_t type_size = fossil_sort_kind_sizeof(kind);
+    size_t *ranks = malloc(q_count * sizeof(size_t));
+    void *work = in_place ? base : malloc(count * type_size);
+    if (!ranks || !work) {
+        free(ranks);
+        if (!in_place)
+            free(work);
+        return -5;
+    }
+    if (!in_place)
+        memcpy(work, base, count * type_size);
+
+    // Nearest rank: the smallest element with at least q * n elements at or
+    // below it.
+    for (size_t i = 0; i < q_count; ++i) {
+        double r = ceil(qs[i] * (double)count);
+        ranks[i] = r < 1.0 ? 0 : ((size_t)r > count ? count - 1 : (size_t)r - 1);
+    }
+
+    int status = count < 2 ? 0 : fossil_select_kind(work, count, kind, type_size, ranks, q_count, false);
+    if (status == 0)
+        for (size_t i = 0; i < q_count; ++i)
+            memcpy((char *)out + i * type_size, (char *)work + ranks[i] * type_size, type_size);
+
+    free(ranks);
+    if (!in_place)
+        free(work);
+    return status;
+}
+
+int fossil_algorithm_sort_median(
+    void *base,
+    size_t count,
+    const char *type_id,
+    void *out,
+    bool in_place)
+{
+    double half = 0.5;
+    return fossil_algorithm_sort_quantiles(base, count, type_id, &half, 1, out, in_place);
+}
+
+// ======================================================
+// Sortedness
+// ======================================================
+
+/**
+ * @brief Pairs compared by the inversion estimate.
+ */
+#define FOSSIL_SORT_INVERSION_SAMPLES 1024
+
+size_t fossil_algorithm_sort_is_sorted_until(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id)
+{
+    if (!base || !type_id)
+        return 0;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return 0;
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    return fossil_sorted_until_kind(base, count, kind, type_size, cmp, desc);
+}
+
+bool fossil_algorithm_sort_is_sorted(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id)
+{
+    if (!base || !type_id)
+        return false;
+    if (count == 0)
+        return fossil_algorithm_sort_type_supported(type_id);
+    return fossil_algorithm_sort_is_sorted_until(base, count, type_id, order_id) == count;
+}
+
+int fossil_algorithm_sort_presortedness(
+    const void *base,
+    size_t count,
+    const char *type_id,
+    const char *order_id,
+    fossil_algorithm_sort_sortedness_t *out)
+{
+    if (!base || !type_id || !out)
+        return -1;
+
+    fossil_sort_kind_t kind;
+    size_t type_size;
+    fossil_sort_compare_fn cmp;
+    if (fossil_sort_resolve_type(type_id, &kind, &type_size, &cmp) != 0)
+        return -2;
+
+    bool desc = (order_id && strcmp(order_id, "desc") == 0);
+    out->sorted_prefix = fossil_sorted_until_kind(base, count, kind, type_size, cmp, desc);
+    out->runs = count == 0 ? 0 : 1;
+    out->inversion_ratio = 0.0;
+    if (out->sorted_prefix == count)
+        return 0;
+
+    out->runs += fossil_sort_descents_kind(base, count, kind, type_size, cmp, desc);
+
+    const char *a = (const char *)base;
+    uint64_t state = 0x9E3779B97F4A7C15ull ^ count;
+    size_t inversions = 0;
+    for (size_t s = 0; s < FOSSIL_SORT_INVERSION_SAMPLES; ++s) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        size_t i = (size_t)(state % count);
+        size_t j = (size_t)((state >> 32) % count);
+        if (i == j)
+            j = i + 1 < count ? i + 1 : i - 1;
+        if (i > j) {
+            size_t t = i;
+            i = j;
+            j = t;
+        }
+        inversions += cmp(a + j * type_size, a + i * type_size, desc) < 0;
+    }
+    out->inversion_ratio = (double)inversions / FOSSIL_SORT_INVERSION_SAMPLES;
+    return 0;
+}
@@ -0,0 +1,135 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#ifndef FOSSIL_ALGORITHM_THREAD_H
+#define FOSSIL_ALGORITHM_THREAD_H
+
+// Internal to the library: the portable thread shim shared by the parallel
+// passes of the sort and search modules. Not part of the public headers.
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Most threads any parallel pass starts.
+ */
+#define FOSSIL_ALGORITHM_MAX_THREADS 64
+
+// A thread that cannot be started runs its work on the caller instead, so
+// results never depend on how many threads the platform grants.
+typedef struct {
+    void (*fn)(void *);
+    void *arg;
+    bool started;
+#ifdef _WIN32
+    HANDLE handle;
+#else
+    pthread_t handle;
+#endif
+} fossil_algorithm_thread_t;
+
+#ifdef _WIN32
+static DWORD WINAPI fossil_algorithm_thread_main(LPVOID param)
+{
+    fossil_algorithm_thread_t *t = (fossil_algorithm_thread_t *)param;
+    t->fn(t->arg);
+    return 0;
+}
+#else
+static void *fossil_algorithm_thread_main(void *param)
+{
+    fossil_algorithm_thread_t *t = (fossil_algorithm_thread_t *)param;
+    t->fn(t->arg);
+    return NULL;
+}
+#endif
+
+static inline void fossil_algorithm_thread_start(fossil_algorithm_thread_t *t, void (*fn)(void *), void *arg)
+{
+    t->fn = fn;
+    t->arg = arg;
+#ifdef _WIN32
+    t->handle = CreateThread(NULL, 0, fossil_algorithm_thread_main, t, 0, NULL);
+    t->started = (t->handle != NULL);
+#else
+    t->started = (pthread_create(&t->handle, NULL, fossil_algorithm_thread_main, t) == 0);
+#endif
+    if (!t->started)
+        fn(arg);
+}
+
+static inline void fossil_algorithm_thread_join(fossil_algorithm_thread_t *t)
+{
+    if (!t->started)
+        return;
+#ifdef _WIN32
+    WaitForSingleObject(t->handle, INFINITE);
+    CloseHandle(t->handle);
+#else
+    pthread_join(t->handle, NULL);
+#endif
+    t->started = false;
+}
+
+// Runs fn over every job, one thread per job beyond the first, which runs on
+// the calling thread. count is at most FOSSIL_ALGORITHM_MAX_THREADS.
+static inline void fossil_algorithm_run_parallel(void (*fn)(void *), void *jobs, size_t job_size, size_t count)
+{
+    fossil_algorithm_thread_t threads[FOSSIL_ALGORITHM_MAX_THREADS];
+    for (size_t t = 1; t < count; ++t)
+        fossil_algorithm_thread_start(&threads[t], fn, (char *)jobs + t * job_size);
+    fn(jobs);
+    for (size_t t = 1; t < count; ++t)
+        fossil_algorithm_thread_join(&threads[t]);
+}
+
+// Online processors, or 1 when the platform cannot tell.
+static inline size_t fossil_algorithm_cpu_count(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#elif defined(_SC_NPROCESSORS_ONLN)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#else
+    return 1;
+#endif
+}
+
+#endif /* FOSSIL_ALGORITHM_THREAD_H */
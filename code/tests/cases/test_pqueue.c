@@ -0,0 +1,113 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/algorithm/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_algorithm_pqueue_fixture);
+
+FOSSIL_SETUP(c_algorithm_pqueue_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_algorithm_pqueue_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Priority Queue
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_pqueue_push_pop_min_i32) {
+    fossil_algorithm_pqueue_t *pq = fossil_algorithm_pqueue_create("i32", "asc", 0);
+    ASSUME_ITS_TRUE(pq != NULL);
+    int32_t values[] = {7, 3, 9, 1, 5, 3};
+    for (int i = 0; i < 6; ++i)
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_push(pq, &values[i], NULL), 0);
+    int32_t expected[] = {1, 3, 3, 5, 7, 9};
+    for (int i = 0; i < 6; ++i) {
+        int32_t out = 0;
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_pop(pq, &out, NULL), 0);
+        ASSUME_ITS_EQUAL_I32(out, expected[i]);
+    }
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_pop(pq, NULL, NULL), -2);
+    fossil_algorithm_pqueue_destroy(pq);
+}
+
+FOSSIL_TEST(c_test_pqueue_heapify_max_f64) {
+    fossil_algorithm_pqueue_t *pq = fossil_algorithm_pqueue_create("f64", "desc", 0);
+    double values[] = {2.5, 9.75, -1.0, 4.0, 9.5};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_heapify(pq, values, 5, NULL), 0);
+    ASSUME_ITS_TRUE(fossil_algorithm_pqueue_size(pq) == 5);
+    double top = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_top(pq, &top, NULL), 0);
+    ASSUME_ITS_TRUE(top == 9.75);
+    double replaced = 0.0, incoming = 0.5;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_replace_top(pq, &incoming, &replaced), 0);
+    ASSUME_ITS_TRUE(replaced == 9.75);
+    fossil_algorithm_pqueue_top(pq, &top, NULL);
+    ASSUME_ITS_TRUE(top == 9.5);
+    fossil_algorithm_pqueue_destroy(pq);
+}
+
+FOSSIL_TEST(c_test_pqueue_update_key_handles) {
+    fossil_algorithm_pqueue_t *pq = fossil_algorithm_pqueue_create("u32", "asc", 4);
+    uint32_t values[] = {40, 10, 30, 20};
+    size_t handles[4];
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_heapify(pq, values, 4, handles), 0);
+    uint32_t lowered = 5;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_update_key(pq, handles[0], &lowered), 0);
+    uint32_t out = 0;
+    size_t handle = FOSSIL_ALGORITHM_PQUEUE_NPOS;
+    fossil_algorithm_pqueue_pop(pq, &out, &handle);
+    ASSUME_ITS_EQUAL_I32(out, 5);
+    ASSUME_ITS_TRUE(handle == handles[0]);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_pqueue_update_key(pq, handles[0], &lowered), -3);
+    fossil_algorithm_pqueue_destroy(pq);
+}
+
+FOSSIL_TEST(c_test_pqueue_create_unknown_type) {
+    ASSUME_ITS_TRUE(fossil_algorithm_pqueue_create("notatype", "asc", 0) == NULL);
+    ASSUME_ITS_TRUE(fossil_algorithm_pqueue_size(NULL) == 0);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_pqueue_tests) {
+    FOSSIL_TEST_ADD(c_algorithm_pqueue_fixture, c_test_pqueue_push_pop_min_i32);
+    FOSSIL_TEST_ADD(c_algorithm_pqueue_fixture, c_test_pqueue_heapify_max_f64);
+    FOSSIL_TEST_ADD(c_algorithm_pqueue_fixture, c_test_pqueue_update_key_handles);
+    FOSSIL_TEST_ADD(c_algorithm_pqueue_fixture, c_test_pqueue_create_unknown_type);
+
+    FOSSIL_TEST_REGISTER(c_algorithm_pqueue_fixture);
+} // end of tests
@@ -0,0 +1,115 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/algorithm/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(cpp_algorithm_pqueue_fixture);
+
+FOSSIL_SETUP(cpp_algorithm_pqueue_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(cpp_algorithm_pqueue_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Priority Queue
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(cpp_test_pqueue_push_pop_min_i32) {
+    fossil::algorithm::PriorityQueue pq("i32", "asc");
+    ASSUME_ITS_TRUE(pq.valid());
+    int32_t values[] = {7, 3, 9, 1, 5, 3};
+    for (int i = 0; i < 6; ++i)
+        ASSUME_ITS_EQUAL_I32(pq.push(&values[i]), 0);
+    int32_t expected[] = {1, 3, 3, 5, 7, 9};
+    for (int i = 0; i < 6; ++i) {
+        int32_t out = 0;
+        ASSUME_ITS_EQUAL_I32(pq.pop(&out), 0);
+        ASSUME_ITS_EQUAL_I32(out, expected[i]);
+    }
+    ASSUME_ITS_TRUE(pq.empty());
+}
+
+FOSSIL_TEST(cpp_test_pqueue_heapify_max_cstr) {
+    fossil::algorithm::PriorityQueue pq("cstr", "desc");
+    const char *values[] = {"kiwi", "apple", "pear", "fig"};
+    ASSUME_ITS_EQUAL_I32(pq.heapify(values, 4), 0);
+    const char *top = nullptr;
+    ASSUME_ITS_EQUAL_I32(pq.top(&top), 0);
+    ASSUME_ITS_TRUE(strcmp(top, "pear") == 0);
+    const char *incoming = "banana";
+    const char *replaced = nullptr;
+    ASSUME_ITS_EQUAL_I32(pq.replace_top(&incoming, &replaced), 0);
+    ASSUME_ITS_TRUE(strcmp(replaced, "pear") == 0);
+    pq.top(&top);
+    ASSUME_ITS_TRUE(strcmp(top, "kiwi") == 0);
+}
+
+FOSSIL_TEST(cpp_test_pqueue_update_key_handles) {
+    fossil::algorithm::PriorityQueue pq("u32", "asc", 4);
+    uint32_t values[] = {40, 10, 30, 20};
+    size_t handles[4];
+    ASSUME_ITS_EQUAL_I32(pq.heapify(values, 4, handles), 0);
+    uint32_t lowered = 5;
+    ASSUME_ITS_EQUAL_I32(pq.update_key(handles[2], &lowered), 0);
+    uint32_t out = 0;
+    size_t handle = FOSSIL_ALGORITHM_PQUEUE_NPOS;
+    pq.pop(&out, &handle);
+    ASSUME_ITS_EQUAL_I32(out, 5);
+    ASSUME_ITS_TRUE(handle == handles[2]);
+}
+
+FOSSIL_TEST(cpp_test_pqueue_move_and_clear) {
+    fossil::algorithm::PriorityQueue a("i64", "desc");
+    int64_t v = 42;
+    a.push(&v);
+    fossil::algorithm::PriorityQueue b(std::move(a));
+    ASSUME_ITS_TRUE(!a.valid());
+    ASSUME_ITS_TRUE(b.size() == 1);
+    b.clear();
+    ASSUME_ITS_TRUE(b.empty());
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(cpp_pqueue_tests) {
+    FOSSIL_TEST_ADD(cpp_algorithm_pqueue_fixture, cpp_test_pqueue_push_pop_min_i32);
+    FOSSIL_TEST_ADD(cpp_algorithm_pqueue_fixture, cpp_test_pqueue_heapify_max_cstr);
+    FOSSIL_TEST_ADD(cpp_algorithm_pqueue_fixture, cpp_test_pqueue_update_key_handles);
+    FOSSIL_TEST_ADD(cpp_algorithm_pqueue_fixture, cpp_test_pqueue_move_and_clear);
+
+    FOSSIL_TEST_REGISTER(cpp_algorithm_pqueue_fixture);
+} // end of tests
@@ -25,6 +25,7 @@
 #include <fossil/pizza/framework.h>
 
 #include "fossil/algorithm/framework.h"
+#include <math.h>
 
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Utilities
@@ -182,6 +183,465 @@ FOSSIL_TEST(c_test_search_type_supported_true_false) {
     ASSUME_ITS_TRUE(fossil_algorithm_search_type_supported("null") == false);
 }
 
+FOSSIL_TEST(c_test_search_exec_small_auto_f32_signed_zero) {
+    float arr[] = {3.5f, 1.25f, 0.0f, -2.0f, 9.0f, 4.0f};
+    float key = -0.0f;
+    int idx = fossil_algorithm_search_exec(arr, 6, &key, "f32", "auto", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, 2);
+}
+
+FOSSIL_TEST(c_test_search_exec_small_linear_u16_tail) {
+    uint16_t arr[] = {5, 6, 7, 8, 9, 10, 11};
+    uint16_t key = 11;
+    int idx = fossil_algorithm_search_exec(arr, 7, &key, "u16", "linear", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, 6);
+    key = 12;
+    idx = fossil_algorithm_search_exec(arr, 7, &key, "u16", "linear", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, -1);
+}
+
+FOSSIL_TEST(c_test_search_set_intersect_union_difference) {
+    uint32_t a[] = {1, 4, 4, 9, 12, 20};
+    uint32_t b[] = {4, 5, 12, 12, 30};
+    uint32_t out[11];
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(a, 6, b, 5, out, &n, "u32", "intersect", "asc"), 0);
+    ASSUME_ITS_TRUE(n == 2 && out[0] == 4 && out[1] == 12);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(a, 6, b, 5, out, &n, "u32", "union", "asc"), 0);
+    uint32_t all[] = {1, 4, 4, 5, 9, 12, 12, 20, 30};
+    ASSUME_ITS_TRUE(n == 9 && memcmp(out, all, sizeof(all)) == 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(a, 6, b, 5, out, &n, "u32", "difference", "asc"), 0);
+    uint32_t only_a[] = {1, 4, 9, 20};
+    ASSUME_ITS_TRUE(n == 4 && memcmp(out, only_a, sizeof(only_a)) == 0);
+}
+
+FOSSIL_TEST(c_test_search_set_gallop_count_only_desc) {
+    static int64_t big[4000];
+    for (int i = 0; i < 4000; ++i)
+        big[i] = (int64_t)(3999 - i) * 2;
+    int64_t small[] = {7000, 6999, 12, 3};
+    size_t n = 99;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(small, 4, big, 4000, NULL, &n, "i64", "intersect", "desc"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(small, 4, big, 4000, NULL, &n, "i64", "difference", "desc"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+}
+
+FOSSIL_TEST(c_test_search_intersect_many_cstr) {
+    const char *l1[] = {"apple", "fig", "kiwi", "pear"};
+    const char *l2[] = {"fig", "pear"};
+    const char *l3[] = {"banana", "fig", "grape", "pear", "plum"};
+    const void *lists[] = {l1, l2, l3};
+    size_t counts[] = {4, 2, 5};
+    const char *out[2];
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_intersect_many(lists, counts, 3, out, &n, "cstr", "asc"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+    ASSUME_ITS_TRUE(strcmp(out[0], "fig") == 0 && strcmp(out[1], "pear") == 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(l1, 4, l2, 2, NULL, &n, "cstr", "xor", "asc"), -4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_set(l1, 4, l2, 2, NULL, &n, "datetime", "union", "asc"), -3);
+}
+
+FOSSIL_TEST(c_test_search_exec_checked_unsorted) {
+    int32_t sorted[] = {1, 3, 5, 7, 9};
+    int32_t unsorted[] = {1, 9, 5, 7, 3};
+    int32_t key = 7;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(sorted, 5, &key, "i32", "binary", "asc"), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(unsorted, 5, &key, "i32", "binary", "asc"), -6);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(sorted, 5, &key, "i32", "jump", "desc"), -6);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(unsorted, 5, &key, "i32", "linear", "asc"), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(sorted, 5, &key, "nope", "binary", "asc"), -3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(unsorted, 5, &key, "i32", "bogus", "asc"), -4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(sorted, 5, &key, "i32", "bogus", "asc"), -4);
+    float fl[] = {3.0f, 1.0f, 2.0f};
+    float fk = 2.0f;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(fl, 3, &fk, "f32", "interpolation", "asc"), -4);
+}
+
+FOSSIL_TEST(c_test_search_finger_hint) {
+    static int64_t times[1000];
+    for (int i = 0; i < 1000; ++i)
+        times[i] = (int64_t)(i / 2) * 10;
+    size_t hint = 0;
+    int64_t key = 40;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "i64", "asc", &hint), 8);
+    ASSUME_ITS_TRUE(hint == 8);
+    key = 45;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "i64", "asc", &hint), -1);
+    ASSUME_ITS_TRUE(hint == 10);
+    hint = 900;
+    key = 30;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "i64", "asc", &hint), 6);
+    hint = 5000;
+    key = 4990;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "i64", "asc", &hint), 998);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "nope", "asc", &hint), -3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_finger(times, 1000, &key, "i64", "asc", NULL), -2);
+}
+
+FOSSIL_TEST(c_test_search_cursor_monotone_stream) {
+    static uint32_t arr[4096];
+    for (uint32_t i = 0; i < 4096; ++i)
+        arr[i] = i * 3u;
+    fossil_algorithm_search_cursor_t *c = fossil_algorithm_search_cursor_create(arr, 4096, "u32", "asc");
+    ASSUME_ITS_TRUE(c != NULL);
+    bool ok = true;
+    for (uint32_t k = 0; k < 4096 * 3; ++k) {
+        int idx = fossil_algorithm_search_cursor_find(c, &k);
+        ok = ok && idx == (k % 3u == 0 ? (int)(k / 3u) : -1);
+    }
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(fossil_algorithm_search_cursor_position(c) == 4096);
+    fossil_algorithm_search_cursor_seek(c, 0);
+    uint32_t key = 9;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_cursor_find(c, &key), 3);
+    fossil_algorithm_search_cursor_destroy(c);
+    ASSUME_ITS_TRUE(fossil_algorithm_search_cursor_create(arr, 4096, "nope", "asc") == NULL);
+}
+
+FOSSIL_TEST(c_test_search_cursor_cstr_desc) {
+    const char *words[] = {"pear", "kiwi", "kiwi", "fig", "apple"};
+    fossil_algorithm_search_cursor_t *c = fossil_algorithm_search_cursor_create(words, 5, "cstr", "desc");
+    const char *key = "kiwi";
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_cursor_find(c, &key), 1);
+    key = "banana";
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_cursor_find(c, &key), -1);
+    ASSUME_ITS_TRUE(fossil_algorithm_search_cursor_position(c) == 4);
+    fossil_algorithm_search_cursor_destroy(c);
+}
+
+FOSSIL_TEST(c_test_search_nearest_modes_sorted) {
+    double prices[] = {1.0, 2.5, 2.5, 4.0, 7.5};
+    double key = 3.0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "floor", "asc", 0.0), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "ceiling", "asc", 0.0), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "nearest", "asc", 0.0), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "within", "asc", 0.25), -1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "within", "asc", 0.5), 2);
+    key = 0.5;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "floor", "asc", 0.0), -1);
+    key = 9.0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(prices, 5, &key, "f64", "ceiling", "asc", 0.0), -1);
+    int64_t times[] = {900, 500, 300, 100};
+    int64_t t = 450;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(times, 4, &t, "datetime", "floor", "desc", 0.0), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(times, 4, &t, "datetime", "nearest", "desc", 0.0), 1);
+    uint64_t wide[] = {0, UINT64_MAX};
+    uint64_t w = UINT64_MAX - 1;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(wide, 2, &w, "u64", NULL, NULL, 0.0), 1);
+}
+
+FOSSIL_TEST(c_test_search_nearest_unsorted_and_errors) {
+    int32_t v[] = {40, -7, 12, 90, 12, 55};
+    int32_t key = 10;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(v, 6, &key, "i32", "nearest", "unsorted", 0.0), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(v, 6, &key, "i32", "floor", "unsorted", 0.0), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(v, 6, &key, "i32", "ceiling", "unsorted", 0.0), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(v, 6, &key, "cstr", "floor", "asc", 0.0), -3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(v, 6, &key, "i32", "closest", "asc", 0.0), -4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(NULL, 6, &key, "i32", "floor", "asc", 0.0), -2);
+}
+
+FOSSIL_TEST(c_test_search_nearest_many_asof) {
+    static int64_t quotes[1000];
+    static int64_t events[3000];
+    static int out[3000];
+    for (int i = 0; i < 1000; ++i)
+        quotes[i] = (int64_t)i * 30;
+    for (int i = 0; i < 3000; ++i)
+        events[i] = (int64_t)i * 10 + 5;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest_many(quotes, 1000, events, 3000, "i64", "floor", "asc", 0.0, out), 0);
+    bool ok = true;
+    for (int i = 0; i < 3000; ++i)
+        ok = ok && out[i] == (i * 10 + 5) / 30;
+    ASSUME_ITS_TRUE(ok);
+}
+
+FOSSIL_TEST(c_test_search_nearest_wide_integers) {
+    int64_t a[] = {0, (int64_t)1 << 60};
+    int64_t key = ((int64_t)1 << 59) + 1;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(a, 2, &key, "i64", "nearest", "asc", 0.0), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(a, 2, &key, "i64", "nearest", "unsorted", 0.0), 1);
+    int64_t ends[] = {INT64_MIN, INT64_MAX};
+    key = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(ends, 2, &key, "i64", "nearest", "asc", 0.0), 1);
+    uint64_t u[] = {0, UINT64_MAX};
+    uint64_t ukey = (uint64_t)1 << 63;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest(u, 2, &ukey, "u64", "nearest", "asc", 0.0), 1);
+    int out[1];
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_nearest_many(u, 2, &ukey, 1, "u64", "nearest", "asc", 0.0, out), 0);
+    ASSUME_ITS_EQUAL_I32(out[0], 1);
+}
+
+FOSSIL_TEST(c_test_search_argmin_argmax) {
+    int32_t v[] = {5, -3, 9, -3, 9, 0, 7};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmin(v, 7, "i32"), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmax(v, 7, "i32"), 2);
+    int32_t lo = 0, hi = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_min(v, 7, "i32", &lo), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_max(v, 7, "i32", &hi), 0);
+    ASSUME_ITS_TRUE(lo == -3 && hi == 9);
+    const char *words[] = {"pear", "apple", "zebra", "apple"};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmin(words, 4, "cstr"), 1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmax(words, 4, "cstr"), 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmin(v, 0, "i32"), -2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_argmin(v, 7, "nope"), -3);
+}
+
+FOSSIL_TEST(c_test_search_minmax_nan_and_threads) {
+    double d[] = {NAN, 2.5, NAN, -1.0, 8.0};
+    size_t imin = 0, imax = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_minmax(d, 5, "f64", &imin, &imax, 1), 0);
+    ASSUME_ITS_TRUE(imin == 3 && imax == 4);
+    double all_nan[] = {NAN, NAN};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_minmax(all_nan, 2, "f64", &imin, &imax, 1), -1);
+    static uint16_t big[300000];
+    for (size_t i = 0; i < 300000; ++i)
+        big[i] = (uint16_t)(1000 + i % 5000);
+    big[123457] = 7;
+    big[250001] = 7;
+    big[299999] = 60000;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_minmax(big, 300000, "u16", &imin, &imax, 4), 0);
+    ASSUME_ITS_TRUE(imin == 123457 && imax == 299999);
+    int64_t stamps[] = {1700000000, 1600000000, 1800000000};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_minmax(stamps, 3, "datetime", &imin, &imax, 0), 0);
+    ASSUME_ITS_TRUE(imin == 1 && imax == 2);
+}
+
+FOSSIL_TEST(c_test_search_find_all_predicates) {
+    int32_t v[] = {5, -3, 9, -3, 12, 0, 7, -3};
+    size_t sel[8];
+    size_t n = 0;
+    int32_t key = -3;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_find_all(v, 8, "i32", "eq", &key, NULL, sel, &n, 1), 0);
+    ASSUME_ITS_TRUE(n == 3 && sel[0] == 1 && sel[1] == 3 && sel[2] == 7);
+    int32_t lo = 0, hi = 9;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_find_all(v, 8, "i32", "range", &lo, &hi, sel, &n, 1), 0);
+    ASSUME_ITS_TRUE(n == 4 && sel[0] == 0 && sel[1] == 2 && sel[2] == 5 && sel[3] == 6);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_count_matches(v, 8, "i32", "gt", &lo, NULL, &n, 1), 0);
+    ASSUME_ITS_TRUE(n == 4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_count_matches(v, 8, "i32", "ne", &key, NULL, &n, 1), 0);
+    ASSUME_ITS_TRUE(n == 5);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_count_matches(v, 8, "i32", "like", &key, NULL, &n, 1), -4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_count_matches(v, 8, "cstr", "eq", &key, NULL, &n, 1), -3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_count_matches(v, 8, "i32", "range", &lo, NULL, &n, 1), -2);
+}
+
+FOSSIL_TEST(c_test_search_match_bitmap_feeds_filter) {
+    double d[] = {1.5, 9.0, 3.25, 7.0, 2.0, 8.5, 0.5, 6.0, 4.0, 10.0};
+    unsigned char bits[2];
+    size_t n = 0;
+    double limit = 5.0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_match_bitmap(d, 10, "f64", "lt", &limit, NULL, bits, &n, 1), 0);
+    ASSUME_ITS_TRUE(n == 5 && bits[0] == 0x55 && bits[1] == 0x01);
+    double out[10];
+    size_t kept = 0;
+    ASSUME_ITS_TRUE(fossil_algorithm_sort_filter(d, out, 10, "f64", "mask", bits, NULL, &kept) == 0);
+    ASSUME_ITS_TRUE(kept == 5 && out[0] == 1.5 && out[4] == 4.0);
+}
+
+FOSSIL_TEST(c_test_search_find_all_threads) {
+    static uint16_t v[300001];
+    static size_t sel[300001];
+    static unsigned char bits[(300001 + 7) / 8];
+    for (size_t i = 0; i < 300001; ++i)
+        v[i] = (uint16_t)(i % 1000);
+    uint16_t key = 999;
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_find_all(v, 300001, "u16", "eq", &key, NULL, sel, &n, 4), 0);
+    bool ok = n == 300;
+    for (size_t i = 0; ok && i < n; ++i)
+        ok = sel[i] == i * 1000 + 999;
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_match_bitmap(v, 300001, "u16", "eq", &key, NULL, bits, &n, 4), 0);
+    ASSUME_ITS_TRUE(n == 300 && (bits[999 / 8] >> (999 % 8) & 1) && bits[300000 / 8] == 0);
+}
+
+FOSSIL_TEST(c_test_search_parallel_lowest_index) {
+    static uint32_t v[600000];
+    for (size_t i = 0; i < 600000; ++i)
+        v[i] = (uint32_t)(i % 50000) + 1;
+    v[550000] = 0;
+    v[400000] = 0;
+    v[70000] = 0;
+    uint32_t key = 0;
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(v, 600000, &key, "u32", "first", 8, &index), 0);
+    ASSUME_ITS_TRUE(index == 70000);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(v, 600000, &key, "u32", "any", 8, &index), 0);
+    ASSUME_ITS_TRUE(index == 70000 || index == 400000 || index == 550000);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec(v, 600000, &key, "u32", "parallel", "asc"), 70000);
+    key = 49999;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec(v, 600000, &key, "u32", "parallel", NULL), 49998);
+    key = 60000;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(v, 600000, &key, "u32", "first", 4, &index), -1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(v, 600000, &key, "u32", "some", 4, &index), -4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(v, 600000, &key, "datetime", "first", 4, &index), -3);
+}
+
+FOSSIL_TEST(c_test_search_parallel_cstr) {
+    const char *words[] = {"pear", "fig", "kiwi", "fig", "plum"};
+    const char *key = "fig";
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_parallel(words, 5, &key, "cstr", NULL, 0, &index), 0);
+    ASSUME_ITS_TRUE(index == 1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_checked(words, 5, &key, "cstr", "parallel", "asc"), 1);
+}
+
+typedef struct {
+    int64_t stamp;
+    uint16_t port;
+    float load;
+    const char *name;
+    char pad[8];
+} c_search_record_t;
+
+FOSSIL_TEST(c_test_search_strided_record_fields) {
+    c_search_record_t r[6];
+    const char *names[] = {"ash", "birch", "cedar", "elm", "fir", "oak"};
+    for (size_t i = 0; i < 6; ++i) {
+        r[i].stamp = 1000 + (int64_t)i * 250;
+        r[i].port = (uint16_t)(9000 - i * 10);
+        r[i].load = (float)i * 0.5f;
+        r[i].name = names[i];
+    }
+    int64_t stamp = 1750;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, stamp), &stamp, "datetime", "binary", "asc"), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, stamp), &stamp, "i64", "interpolation", "asc"), 3);
+    uint16_t port = 8960;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, port), &port, "u16", "interpolation", "desc"), 4);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, port), &port, "u16", "jump", "desc"), 4);
+    float load = 1.5f;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, load), &load, "f32", "linear", NULL), 3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, load), &load, "f32", "interpolation", "asc"), -4);
+    const char *name = "elm";
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, name), &name, "cstr", "binary", "asc"), 3);
+    stamp = 1100;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), offsetof(c_search_record_t, stamp), &stamp, "i64", "binary", "asc"), -1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, sizeof(r[0]), sizeof(r[0]) - 4, &stamp, "i64", "linear", "asc"), -2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(r, 6, 0, 0, &stamp, "i64", "linear", "asc"), -2);
+}
+
+FOSSIL_TEST(c_test_search_strided_binary_first_duplicate) {
+    int32_t pairs[] = {1, 0, 3, 0, 3, 1, 3, 2, 7, 0, 9, 0};
+    int32_t key = 3;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(pairs, 6, 2 * sizeof(int32_t), 0, &key, "i32", "binary", "asc"), 1);
+    key = 2;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_strided(pairs, 6, 2 * sizeof(int32_t), sizeof(int32_t), &key, "i32", "auto", "asc"), 3);
+}
+
+FOSSIL_TEST(c_test_search_subsequence_char_and_i16) {
+    const char log[] = "GET /a 200; GET /b 404; POST /c 404;";
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence(log, sizeof(log) - 1, "404", 3, "char"), 19);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence(log, sizeof(log) - 1, "500", 3, "char"), -1);
+    size_t at[8], n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence_all(log, sizeof(log) - 1, "404;", 4, "char", at, &n), 0);
+    ASSUME_ITS_TRUE(n == 2 && at[0] == 19 && at[1] == 32);
+    int16_t wave[] = {1, -2, 1, -2, 1, -2, 3, 1, -2};
+    int16_t motif[] = {1, -2, 1};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence_all(wave, 9, motif, 3, "i16", at, &n), 0);
+    ASSUME_ITS_TRUE(n == 2 && at[0] == 0 && at[1] == 2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence(wave, 9, motif, 0, "i16"), -2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence(wave, 9, motif, 3, "f32"), -3);
+}
+
+FOSSIL_TEST(c_test_search_subsequence_periodic_needle) {
+    static uint8_t hay[20000];
+    static uint8_t needle[1001];
+    needle[500] = 1;
+    hay[15000 + 500] = 1;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence(hay, 20000, needle, 1001, "u8"), 15000);
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_subsequence_all(hay, 20000, needle, 1001, "u8", NULL, &n), 0);
+    ASSUME_ITS_TRUE(n == 1);
+}
+
+FOSSIL_TEST(c_test_search_patterns_leftmost_and_all) {
+    const char *words[] = {"error", "warn", "err", "timeout"};
+    size_t lengths[] = {5, 4, 3, 7};
+    fossil_algorithm_search_patterns_t *set =
+        fossil_algorithm_search_patterns_create((const void *const *)words, lengths, 4, "char");
+    ASSUME_ITS_TRUE(set != NULL);
+    const char line[] = "warn: disk timeout, error 5";
+    size_t pattern = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_patterns_find(set, line, sizeof(line) - 1, &pattern), 0);
+    ASSUME_ITS_TRUE(pattern == 1);
+    size_t at[8], ids[8], n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_patterns_find_all(set, line, sizeof(line) - 1, at, ids, 8, &n), 0);
+    ASSUME_ITS_TRUE(n == 4);
+    ASSUME_ITS_TRUE(at[0] == 0 && ids[0] == 1 && at[1] == 11 && ids[1] == 3);
+    ASSUME_ITS_TRUE(at[2] == 20 && ids[2] == 2 && at[3] == 20 && ids[3] == 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_patterns_find(set, "all good", 8, NULL), -1);
+    fossil_algorithm_search_patterns_destroy(set);
+    ASSUME_ITS_TRUE(fossil_algorithm_search_patterns_create((const void *const *)words, lengths, 4, "f64") == NULL);
+}
+
+FOSSIL_TEST(c_test_search_filter_bloom_and_xor) {
+    static uint32_t ids[4096];
+    for (size_t i = 0; i < 4096; ++i)
+        ids[i] = (uint32_t)(i * 2 + 1);
+    const char *methods[] = {"bloom", "xor"};
+    for (size_t m = 0; m < 2; ++m) {
+        fossil_algorithm_search_filter_t *f = fossil_algorithm_search_filter_create(ids, 4096, "u32", methods[m], 0.0);
+        ASSUME_ITS_TRUE(f != NULL);
+        bool all = true;
+        size_t passed = 0;
+        for (uint32_t i = 0; i < 4096; ++i) {
+            all = all && fossil_algorithm_search_filter_contains(f, &ids[i]);
+            uint32_t miss = i * 2 + 2;
+            passed += fossil_algorithm_search_filter_contains(f, &miss);
+        }
+        ASSUME_ITS_TRUE(all);
+        ASSUME_ITS_TRUE(passed < 4096 / 20);
+        fossil_algorithm_search_filter_stats_t st;
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_filter_stats(f, &st), 0);
+        ASSUME_ITS_TRUE(st.key_count == 4096 && st.bits_per_key > 9.0 && st.bits_per_key < 11.0);
+        ASSUME_ITS_TRUE(st.false_positive_rate > 0.0 && st.false_positive_rate < 0.05);
+        uint32_t key = 2001;
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, ids, 4096, &key, "u32", "binary", "asc"), 1000);
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, ids, 4096, &key, "i64", "binary", "asc"), -3);
+        fossil_algorithm_search_filter_destroy(f);
+    }
+    ASSUME_ITS_TRUE(fossil_algorithm_search_filter_create(ids, 4096, "u32", "cuckoo", 0.0) == NULL);
+}
+
+FOSSIL_TEST(c_test_search_filter_cstr_and_signed_zero) {
+    const char *hosts[] = {"alpha", "beta", "gamma", "beta", NULL};
+    fossil_algorithm_search_filter_t *f = fossil_algorithm_search_filter_create(hosts, 5, "cstr", "xor", 0.0);
+    ASSUME_ITS_TRUE(f != NULL);
+    char buf[] = "gamma";
+    const char *key = buf;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, hosts, 5, &key, "cstr", "linear", NULL), 2);
+    const char *empty = "";
+    ASSUME_ITS_TRUE(fossil_algorithm_search_filter_contains(f, &empty));
+    fossil_algorithm_search_filter_stats_t st;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_filter_stats(f, &st), 0);
+    ASSUME_ITS_TRUE(st.key_count == 4);
+    fossil_algorithm_search_filter_destroy(f);
+
+    double d[] = {-0.0, 1.5, 2.5};
+    double zero = 0.0;
+    f = fossil_algorithm_search_filter_create(d, 3, "f64", "bloom", 16.0);
+    ASSUME_ITS_TRUE(fossil_algorithm_search_filter_contains(f, &zero));
+    fossil_algorithm_search_filter_destroy(f);
+}
+
+FOSSIL_TEST(c_test_search_filter_datetime_keys) {
+    int64_t stamps[] = {-86400, 0, 1700000000, 1700003600, 1800000000};
+    const char *methods[] = {"bloom", "xor"};
+    for (size_t m = 0; m < 2; ++m) {
+        fossil_algorithm_search_filter_t *f = fossil_algorithm_search_filter_create(stamps, 5, "datetime", methods[m], 0.0);
+        ASSUME_ITS_TRUE(f != NULL);
+        int64_t key = 1700003600;
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, stamps, 5, &key, "datetime", "binary", "asc"), 3);
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, stamps, 5, &key, "datetime", "jump", "asc"), 3);
+        key = -86400;
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, stamps, 5, &key, "datetime", "linear", NULL), 0);
+        ASSUME_ITS_EQUAL_I32(fossil_algorithm_search_exec_filtered(f, stamps, 5, &key, "duration", "linear", NULL), 0);
+        fossil_algorithm_search_filter_destroy(f);
+    }
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -206,6 +666,34 @@ FOSSIL_TEST_GROUP(c_search_tests) {
     FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_exec_zero_count);
     FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_type_sizeof_supported);
     FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_type_supported_true_false);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_exec_small_auto_f32_signed_zero);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_exec_small_linear_u16_tail);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_set_intersect_union_difference);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_set_gallop_count_only_desc);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_intersect_many_cstr);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_exec_checked_unsorted);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_finger_hint);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_cursor_monotone_stream);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_cursor_cstr_desc);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_nearest_modes_sorted);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_nearest_unsorted_and_errors);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_nearest_many_asof);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_nearest_wide_integers);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_argmin_argmax);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_minmax_nan_and_threads);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_find_all_predicates);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_match_bitmap_feeds_filter);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_find_all_threads);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_parallel_lowest_index);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_parallel_cstr);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_strided_record_fields);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_strided_binary_first_duplicate);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_subsequence_char_and_i16);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_subsequence_periodic_needle);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_patterns_leftmost_and_all);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_filter_bloom_and_xor);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_filter_cstr_and_signed_zero);
+    FOSSIL_TEST_ADD(c_algorithm_search_fixture, c_test_search_filter_datetime_keys);
 
     FOSSIL_TEST_REGISTER(c_algorithm_search_fixture);
 } // end of tests
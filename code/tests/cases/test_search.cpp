@@ -182,6 +182,274 @@ FOSSIL_TEST(cpp_test_search_type_supported_true_false) {
     ASSUME_ITS_TRUE(fossil::algorithm::Search::type_supported("null") == false);
 }
 
+FOSSIL_TEST(cpp_test_search_static_binary_search) {
+    constexpr std::array<int, 7> table = {2, 3, 5, 7, 11, 13, 17};
+    static_assert(fossil::algorithm::static_binary_search(table, 11) == 4, "found at compile time");
+    static_assert(fossil::algorithm::static_binary_search(table, 4) == -1, "missing at compile time");
+    ASSUME_ITS_TRUE(fossil::algorithm::static_binary_search(table, 2) == 0);
+    ASSUME_ITS_TRUE(fossil::algorithm::static_binary_search(table, 18) == -1);
+}
+
+FOSSIL_TEST(cpp_test_search_perfect_hash_keywords) {
+    constexpr auto kw = fossil::algorithm::make_perfect_hash<8>(
+        {"if", "else", "while", "for", "return", "break", "continue", "switch"});
+    static_assert(kw.ok, "perfect hash must build at compile time");
+    static_assert(kw.find("return") == 4, "lookup at compile time");
+    ASSUME_ITS_TRUE(kw.find("continue") == 6);
+    ASSUME_ITS_TRUE(kw.find("goto") == -1);
+    ASSUME_ITS_TRUE(kw.find("") == -1);
+}
+
+FOSSIL_TEST(cpp_test_search_perfect_hash_rejects_duplicates) {
+    constexpr auto bad = fossil::algorithm::make_perfect_hash<3>({"a", "b", "a"});
+    static_assert(!bad.ok, "duplicates are reported");
+    ASSUME_ITS_TRUE(!bad.ok);
+}
+
+FOSSIL_TEST(cpp_test_search_exec_small_auto_f32_signed_zero) {
+    float arr[] = {3.5f, 1.25f, 0.0f, -2.0f, 9.0f, 4.0f};
+    float key = -0.0f;
+    int idx = fossil::algorithm::Search::exec(arr, 6, &key, "f32", "auto", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, 2);
+}
+
+FOSSIL_TEST(cpp_test_search_exec_small_linear_u16_tail) {
+    uint16_t arr[] = {5, 6, 7, 8, 9, 10, 11};
+    uint16_t key = 11;
+    int idx = fossil::algorithm::Search::exec(arr, 7, &key, "u16", "linear", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, 6);
+    key = 12;
+    idx = fossil::algorithm::Search::exec(arr, 7, &key, "u16", "linear", "asc");
+    ASSUME_ITS_EQUAL_I32(idx, -1);
+}
+
+FOSSIL_TEST(cpp_test_search_set_intersect_union_difference) {
+    uint32_t a[] = {1, 4, 4, 9, 12, 20};
+    uint32_t b[] = {4, 5, 12, 12, 30};
+    uint32_t out[11];
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(a, 6, b, 5, out, &n, "u32", "intersect"), 0);
+    ASSUME_ITS_TRUE(n == 2 && out[0] == 4 && out[1] == 12);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(a, 6, b, 5, out, &n, "u32", "union"), 0);
+    uint32_t all[] = {1, 4, 4, 5, 9, 12, 12, 20, 30};
+    ASSUME_ITS_TRUE(n == 9 && memcmp(out, all, sizeof(all)) == 0);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(a, 6, b, 5, out, &n, "u32", "difference"), 0);
+    uint32_t only_a[] = {1, 4, 9, 20};
+    ASSUME_ITS_TRUE(n == 4 && memcmp(out, only_a, sizeof(only_a)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_search_set_gallop_count_only_desc) {
+    static int64_t big[4000];
+    for (int i = 0; i < 4000; ++i)
+        big[i] = (int64_t)(3999 - i) * 2;
+    int64_t small[] = {7000, 6999, 12, 3};
+    size_t n = 99;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(small, 4, big, 4000, nullptr, &n, "i64", "intersect", "desc"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(small, 4, big, 4000, nullptr, &n, "i64", "difference", "desc"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+}
+
+FOSSIL_TEST(cpp_test_search_intersect_many_cstr) {
+    const char *l1[] = {"apple", "fig", "kiwi", "pear"};
+    const char *l2[] = {"fig", "pear"};
+    const char *l3[] = {"banana", "fig", "grape", "pear", "plum"};
+    const void *lists[] = {l1, l2, l3};
+    size_t counts[] = {4, 2, 5};
+    const char *out[2];
+    size_t n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::intersect_many(lists, counts, 3, out, &n, "cstr"), 0);
+    ASSUME_ITS_TRUE(n == 2);
+    ASSUME_ITS_TRUE(strcmp(out[0], "fig") == 0 && strcmp(out[1], "pear") == 0);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(l1, 4, l2, 2, nullptr, &n, "cstr", "xor"), -4);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::set(l1, 4, l2, 2, nullptr, &n, "datetime", "union"), -3);
+}
+
+FOSSIL_TEST(cpp_test_search_exec_checked_unsorted) {
+    int32_t sorted[] = {1, 3, 5, 7, 9};
+    int32_t unsorted[] = {1, 9, 5, 7, 3};
+    int32_t key = 7;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::exec_checked(sorted, 5, &key, "i32"), 3);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::exec_checked(unsorted, 5, &key, "i32"), -6);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::exec_checked(unsorted, 5, &key, "i32", "linear"), 3);
+}
+
+FOSSIL_TEST(cpp_test_search_finger_hint) {
+    static int64_t times[1000];
+    for (int i = 0; i < 1000; ++i)
+        times[i] = (int64_t)(i / 2) * 10;
+    size_t hint = 0;
+    int64_t key = 40;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::finger(times, 1000, &key, "i64", hint), 8);
+    key = 45;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::finger(times, 1000, &key, "i64", hint), -1);
+    ASSUME_ITS_TRUE(hint == 10);
+    hint = 900;
+    key = 30;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::finger(times, 1000, &key, "i64", hint), 6);
+}
+
+FOSSIL_TEST(cpp_test_search_cursor_monotone_stream) {
+    static uint32_t arr[4096];
+    for (uint32_t i = 0; i < 4096; ++i)
+        arr[i] = i * 3u;
+    fossil::algorithm::SearchCursor c(arr, 4096, "u32");
+    ASSUME_ITS_TRUE(c.valid());
+    bool ok = true;
+    for (uint32_t k = 0; k < 4096 * 3; ++k) {
+        int idx = c.find(&k);
+        ok = ok && idx == (k % 3u == 0 ? (int)(k / 3u) : -1);
+    }
+    ASSUME_ITS_TRUE(ok);
+    ASSUME_ITS_TRUE(c.position() == 4096);
+    c.seek(0);
+    uint32_t key = 9;
+    ASSUME_ITS_EQUAL_I32(c.find(&key), 3);
+    fossil::algorithm::SearchCursor bad(arr, 4096, "nope");
+    ASSUME_ITS_TRUE(!bad.valid());
+}
+
+FOSSIL_TEST(cpp_test_search_nearest_modes_sorted) {
+    double prices[] = {1.0, 2.5, 2.5, 4.0, 7.5};
+    double key = 3.0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(prices, 5, &key, "f64", "floor"), 2);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(prices, 5, &key, "f64", "ceiling"), 3);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(prices, 5, &key, "f64"), 2);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(prices, 5, &key, "f64", "within", "asc", 0.25), -1);
+    int64_t times[] = {900, 500, 300, 100};
+    int64_t t = 450;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(times, 4, &t, "datetime", "floor", "desc"), 2);
+}
+
+FOSSIL_TEST(cpp_test_search_nearest_many_asof) {
+    static int64_t quotes[1000];
+    static int64_t events[3000];
+    static int out[3000];
+    for (int i = 0; i < 1000; ++i)
+        quotes[i] = (int64_t)i * 30;
+    for (int i = 0; i < 3000; ++i)
+        events[i] = (int64_t)i * 10 + 5;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest_many(quotes, 1000, events, 3000, out, "i64", "floor"), 0);
+    bool ok = true;
+    for (int i = 0; i < 3000; ++i)
+        ok = ok && out[i] == (i * 10 + 5) / 30;
+    ASSUME_ITS_TRUE(ok);
+}
+
+FOSSIL_TEST(cpp_test_search_nearest_wide_integers) {
+    int64_t a[] = {0, (int64_t)1 << 60};
+    int64_t key = ((int64_t)1 << 59) + 1;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(a, 2, &key, "i64"), 1);
+    uint64_t u[] = {0, UINT64_MAX};
+    uint64_t ukey = (uint64_t)1 << 63;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::nearest(u, 2, &ukey, "u64"), 1);
+}
+
+FOSSIL_TEST(cpp_test_search_argmin_argmax) {
+    int32_t v[] = {5, -3, 9, -3, 9, 0, 7};
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::argmin(v, 7, "i32"), 1);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::argmax(v, 7, "i32"), 2);
+    int32_t lo = 0, hi = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::min_value(v, 7, "i32", &lo), 0);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::max_value(v, 7, "i32", &hi), 0);
+    ASSUME_ITS_TRUE(lo == -3 && hi == 9);
+    const char *words[] = {"pear", "apple", "zebra", "apple"};
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::argmin(words, 4, "cstr"), 1);
+}
+
+FOSSIL_TEST(cpp_test_search_minmax_nan_and_threads) {
+    static uint16_t big[300000];
+    for (size_t i = 0; i < 300000; ++i)
+        big[i] = (uint16_t)(1000 + i % 5000);
+    big[123457] = 7;
+    big[250001] = 7;
+    big[299999] = 60000;
+    size_t imin = 0, imax = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::minmax(big, 300000, "u16", &imin, &imax, 4), 0);
+    ASSUME_ITS_TRUE(imin == 123457 && imax == 299999);
+}
+
+FOSSIL_TEST(cpp_test_search_find_all_predicates) {
+    int32_t v[] = {5, -3, 9, -3, 12, 0, 7, -3};
+    size_t sel[8];
+    size_t n = 0;
+    int32_t key = -3;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::find_all(v, 8, "i32", "eq", &key, nullptr, sel, &n), 0);
+    ASSUME_ITS_TRUE(n == 3 && sel[0] == 1 && sel[1] == 3 && sel[2] == 7);
+    int32_t lo = 0, hi = 9;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::count_matches(v, 8, "i32", "range", &lo, &hi, &n), 0);
+    ASSUME_ITS_TRUE(n == 4);
+}
+
+FOSSIL_TEST(cpp_test_search_match_bitmap_feeds_filter) {
+    double d[] = {1.5, 9.0, 3.25, 7.0, 2.0, 8.5, 0.5, 6.0, 4.0, 10.0};
+    unsigned char bits[2];
+    size_t n = 0;
+    double limit = 5.0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::match_bitmap(d, 10, "f64", "lt", &limit, nullptr, bits, &n), 0);
+    ASSUME_ITS_TRUE(n == 5 && bits[0] == 0x55 && bits[1] == 0x01);
+}
+
+FOSSIL_TEST(cpp_test_search_parallel_lowest_index) {
+    static double v[300000];
+    for (size_t i = 0; i < 300000; ++i)
+        v[i] = (double)(i % 1000);
+    v[299999] = -1.0;
+    v[123456] = -1.0;
+    double key = -1.0;
+    size_t index = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::parallel(v, 300000, &key, "f64", index, "first", 4), 0);
+    ASSUME_ITS_TRUE(index == 123456);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::exec(v, 300000, &key, "f64", "parallel"), 123456);
+    key = 2000.0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::parallel(v, 300000, &key, "f64", index), -1);
+}
+
+FOSSIL_TEST(cpp_test_search_strided_record_fields) {
+    struct Entry { uint32_t id; double score; };
+    Entry e[] = {{4, 0.25}, {8, 0.5}, {15, 0.75}, {16, 1.0}, {23, 1.25}, {42, 1.5}};
+    uint32_t id = 23;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::strided(e, 6, sizeof(Entry), offsetof(Entry, id), &id, "u32", "interpolation"), 4);
+    double score = 0.75;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::strided(e, 6, sizeof(Entry), offsetof(Entry, score), &score, "f64", "binary"), 2);
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::strided(e, 6, sizeof(Entry), offsetof(Entry, score), &score, "f64", "exponential"), 2);
+}
+
+FOSSIL_TEST(cpp_test_search_subsequence_and_patterns) {
+    uint32_t codes[] = {7, 3, 9, 3, 9, 3, 1};
+    uint32_t pair[] = {3, 9};
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::subsequence(codes, 7, pair, 2, "u32"), 1);
+    size_t at[8], n = 0;
+    ASSUME_ITS_EQUAL_I32(fossil::algorithm::Search::subsequence_all(codes, 7, pair, 2, "u32", at, &n), 0);
+    ASSUME_ITS_TRUE(n == 2 && at[1] == 3);
+    uint32_t tail[] = {3, 1};
+    const void *patterns[] = {pair, tail};
+    size_t lengths[] = {2, 2};
+    fossil::algorithm::SearchPatterns set(patterns, lengths, 2, "u32");
+    ASSUME_ITS_TRUE(set.valid());
+    size_t pattern = 9;
+    ASSUME_ITS_EQUAL_I32(set.find(codes + 4, 3, &pattern), 1);
+    ASSUME_ITS_TRUE(pattern == 1);
+    size_t ids[8];
+    ASSUME_ITS_EQUAL_I32(set.find_all(codes, 7, at, ids, 8, &n), 0);
+    ASSUME_ITS_TRUE(n == 3 && ids[2] == 1 && at[2] == 5);
+}
+
+FOSSIL_TEST(cpp_test_search_filter_front_end) {
+    int64_t stamps[] = {100, 200, 300, 400, 500, 600, 700, 800};
+    fossil::algorithm::SearchFilter filter(stamps, 8, "datetime", "xor");
+    ASSUME_ITS_TRUE(filter.valid());
+    int64_t key = 700;
+    ASSUME_ITS_TRUE(filter.contains(&key));
+    ASSUME_ITS_EQUAL_I32(filter.exec(stamps, 8, &key, "i64", "binary"), 6);
+    ASSUME_ITS_EQUAL_I32(filter.exec(stamps, 8, &key, "u32", "binary"), -3);
+    fossil::algorithm::SearchFilter moved(std::move(filter));
+    ASSUME_ITS_TRUE(moved.valid() && !filter.valid());
+    fossil_algorithm_search_filter_stats_t st;
+    ASSUME_ITS_EQUAL_I32(moved.stats(st), 0);
+    ASSUME_ITS_TRUE(st.key_count == 8);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -206,6 +474,28 @@ FOSSIL_TEST_GROUP(cpp_search_tests) {
     FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_exec_zero_count);
     FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_type_sizeof_supported);
     FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_type_supported_true_false);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_static_binary_search);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_perfect_hash_keywords);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_perfect_hash_rejects_duplicates);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_exec_small_auto_f32_signed_zero);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_exec_small_linear_u16_tail);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_set_intersect_union_difference);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_set_gallop_count_only_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_intersect_many_cstr);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_exec_checked_unsorted);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_finger_hint);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_cursor_monotone_stream);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_nearest_modes_sorted);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_nearest_many_asof);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_nearest_wide_integers);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_argmin_argmax);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_minmax_nan_and_threads);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_find_all_predicates);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_match_bitmap_feeds_filter);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_parallel_lowest_index);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_strided_record_fields);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_subsequence_and_patterns);
+    FOSSIL_TEST_ADD(cpp_algorithm_search_fixture, cpp_test_search_filter_front_end);
 
     FOSSIL_TEST_REGISTER(cpp_algorithm_search_fixture);
 } // end of tests
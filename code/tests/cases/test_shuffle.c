@@ -133,6 +133,26 @@ FOSSIL_TEST(c_test_shuffle_type_supported_true_false) {
     ASSUME_ITS_TRUE(fossil_algorithm_shuffle_type_supported("notatype") == false);
 }
 
+FOSSIL_TEST(c_test_shuffle_exec_seeded_reproducible) {
+    int64_t a[16], b[16];
+    for (int i = 0; i < 16; ++i)
+        a[i] = b[i] = i;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_shuffle_exec(a, 16, "i64", "fisher-yates", "seeded", 99), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_shuffle_exec(b, 16, "i64", "fisher-yates", "seeded", 99), 0);
+    ASSUME_ITS_TRUE(memcmp(a, b, sizeof(a)) == 0);
+    int64_t sum = 0;
+    for (int i = 0; i < 16; ++i)
+        sum += a[i];
+    ASSUME_ITS_TRUE(sum == 120);
+}
+
+FOSSIL_TEST(c_test_shuffle_exec_single_element) {
+    uint8_t one[] = {42};
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_shuffle_exec(one, 1, "u8", "auto", "auto", 0), 0);
+    ASSUME_ITS_TRUE(one[0] == 42);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_shuffle_exec(one, 1, "u8", "notalgo", "auto", 0), -3);
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -147,6 +167,8 @@ FOSSIL_TEST_GROUP(c_shuffle_tests) {
     FOSSIL_TEST_ADD(c_algorithm_shuffle_fixture, c_test_shuffle_exec_null_type_id);
     FOSSIL_TEST_ADD(c_algorithm_shuffle_fixture, c_test_shuffle_type_sizeof_supported);
     FOSSIL_TEST_ADD(c_algorithm_shuffle_fixture, c_test_shuffle_type_supported_true_false);
+    FOSSIL_TEST_ADD(c_algorithm_shuffle_fixture, c_test_shuffle_exec_seeded_reproducible);
+    FOSSIL_TEST_ADD(c_algorithm_shuffle_fixture, c_test_shuffle_exec_single_element);
 
     FOSSIL_TEST_REGISTER(c_algorithm_shuffle_fixture);
 } // end of tests
@@ -0,0 +1,116 @@
+/**
+ * -----------------------------------------------------------------------------
+ * Project: Fossil Logic
+ *
+ * This file is part of the Fossil Logic project, which aims to develop
+ * high-performance, cross-platform applications and libraries. The code
+ * contained herein is licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License. You may obtain
+ * a copy of the License at:
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ * Author: Michael Gene Brockus (Dreamer)
+ * Date: 04/05/2014
+ *
+ * Copyright (C) 2014-2025 Fossil Logic. All rights reserved.
+ * -----------------------------------------------------------------------------
+ */
+#include <fossil/pizza/framework.h>
+
+#include "fossil/algorithm/framework.h"
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Utilities
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// Setup steps for things like test fixtures and
+// mock objects are set here.
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_SUITE(c_algorithm_sketch_fixture);
+
+FOSSIL_SETUP(c_algorithm_sketch_fixture) {
+    // Setup the test fixture
+}
+
+FOSSIL_TEARDOWN(c_algorithm_sketch_fixture) {
+    // Teardown the test fixture
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Quantile Sketch
+// * * * * * * * * * * * * * * * * * * * * * * * *
+
+FOSSIL_TEST(c_test_sketch_exact_small_i32) {
+    int32_t values[] = {50, 10, 40, 20, 30};
+    double qs[] = {0.0, 0.2, 0.5, 0.9, 1.0};
+    double out[5];
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_exec(values, 5, "i32", "kll", qs, 5, out), 0);
+    ASSUME_ITS_TRUE(out[0] == 10.0 && out[1] == 10.0 && out[2] == 30.0);
+    ASSUME_ITS_TRUE(out[3] == 50.0 && out[4] == 50.0);
+}
+
+FOSSIL_TEST(c_test_sketch_kll_merge_u32) {
+    static uint32_t values[40000];
+    for (uint32_t i = 0; i < 40000; ++i)
+        values[i] = (i * 7919u) % 40000u;
+    fossil_algorithm_sketch_t *all = fossil_algorithm_sketch_create("u32", "kll", 0);
+    fossil_algorithm_sketch_t *part = fossil_algorithm_sketch_create("u32", "kll", 0);
+    ASSUME_ITS_TRUE(all != NULL && part != NULL);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_add_many(all, values, 20000), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_add_many(part, values + 20000, 20000), 0);
+    ASSUME_ITS_TRUE(!fossil_algorithm_sketch_is_exact(all));
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_merge(all, part), 0);
+    ASSUME_ITS_TRUE(fossil_algorithm_sketch_count(all) == 40000);
+    double p50 = 0.0, p99 = 0.0;
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_quantile(all, 0.5, &p50), 0);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_quantile(all, 0.99, &p99), 0);
+    ASSUME_ITS_TRUE(p50 > 20000.0 - 800.0 && p50 < 20000.0 + 800.0);
+    ASSUME_ITS_TRUE(p99 > 39600.0 - 800.0 && p99 < 39600.0 + 800.0);
+    fossil_algorithm_sketch_destroy(part);
+    fossil_algorithm_sketch_destroy(all);
+}
+
+FOSSIL_TEST(c_test_sketch_tdigest_tail_f64) {
+    static double values[50000];
+    for (int i = 0; i < 50000; ++i)
+        values[i] = (double)((i * 31337) % 50000) / 50000.0;
+    double qs[] = {0.5, 0.99, 0.999};
+    double out[3];
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_exec(values, 50000, "f64", "tdigest", qs, 3, out), 0);
+    ASSUME_ITS_TRUE(out[0] > 0.49 && out[0] < 0.51);
+    ASSUME_ITS_TRUE(out[1] > 0.988 && out[1] < 0.992);
+    ASSUME_ITS_TRUE(out[2] > 0.998 && out[2] <= 1.0);
+}
+
+FOSSIL_TEST(c_test_sketch_limits) {
+    fossil_algorithm_sketch_t *kll = fossil_algorithm_sketch_create("f64", "kll", 0);
+    fossil_algorithm_sketch_t *td = fossil_algorithm_sketch_create("f64", "tdigest", 0);
+    double out = 0.0;
+    ASSUME_ITS_TRUE(fossil_algorithm_sketch_create("cstr", "kll", 0) == NULL);
+    ASSUME_ITS_TRUE(fossil_algorithm_sketch_create("f64", "gk", 0) == NULL);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_quantile(kll, 0.5, &out), -2);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_quantile(kll, 1.5, &out), -1);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_merge(kll, td), -3);
+    ASSUME_ITS_EQUAL_I32(fossil_algorithm_sketch_exec(&out, 1, "cstr", "kll", &out, 1, &out), -3);
+    fossil_algorithm_sketch_destroy(td);
+    fossil_algorithm_sketch_destroy(kll);
+}
+
+// * * * * * * * * * * * * * * * * * * * * * * * *
+// * Fossil Logic Test Pool
+// * * * * * * * * * * * * * * * * * * * * * * * *
+FOSSIL_TEST_GROUP(c_sketch_tests) {
+    FOSSIL_TEST_ADD(c_algorithm_sketch_fixture, c_test_sketch_exact_small_i32);
+    FOSSIL_TEST_ADD(c_algorithm_sketch_fixture, c_test_sketch_kll_merge_u32);
+    FOSSIL_TEST_ADD(c_algorithm_sketch_fixture, c_test_sketch_tdigest_tail_f64);
+    FOSSIL_TEST_ADD(c_algorithm_sketch_fixture, c_test_sketch_limits);
+
+    FOSSIL_TEST_REGISTER(c_algorithm_sketch_fixture);
+} // end of tests
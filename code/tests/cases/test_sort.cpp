@@ -144,6 +144,514 @@ FOSSIL_TEST(cpp_test_sort_exec_reverse_sorted_desc) {
     ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
 }
 
+FOSSIL_TEST(cpp_test_sort_exec_i32_heap_duplicates_asc) {
+    int32_t arr[] = {9, -3, 7, 7, 0, 12, -3, 5, 9, 1, 7, 2, 0, 15, -8, 4, 9};
+    int32_t expected[] = {-8, -3, -3, 0, 0, 1, 2, 4, 5, 7, 7, 7, 9, 9, 9, 12, 15};
+    int status = fossil::algorithm::Sort::exec(arr, 17, "i32", "heap", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_cstr_heap_asc) {
+    const char *arr[] = {"kiwi", "apple", "fig", "pear", "banana", "date"};
+    const char *expected[] = {"apple", "banana", "date", "fig", "kiwi", "pear"};
+    int status = fossil::algorithm::Sort::exec(arr, 6, "cstr", "heap", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 6; ++i)
+        ASSUME_ITS_TRUE(strcmp(arr[i], expected[i]) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_i32_shell_large_desc) {
+    int32_t arr[40];
+    for (int i = 0; i < 40; ++i)
+        arr[i] = (i * 17) % 40 - 20;
+    int status = fossil::algorithm::Sort::exec(arr, 40, "i32", "shell", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 40; ++i)
+        ASSUME_ITS_TRUE(arr[i] == 19 - i);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_cstr_shell_asc) {
+    const char *arr[] = {"delta", "alpha", "echo", "charlie", "bravo"};
+    const char *expected[] = {"alpha", "bravo", "charlie", "delta", "echo"};
+    int status = fossil::algorithm::Sort::exec(arr, 5, "cstr", "shell", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 5; ++i)
+        ASSUME_ITS_TRUE(strcmp(arr[i], expected[i]) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_network_constexpr_array) {
+    constexpr std::array<int, 6> sorted = fossil::algorithm::sort_network(std::array<int, 6>{5, 3, 6, 1, 4, 2});
+    static_assert(sorted[0] == 1 && sorted[5] == 6, "network must sort at compile time");
+    for (int i = 0; i < 6; ++i)
+        ASSUME_ITS_TRUE(sorted[i] == i + 1);
+}
+
+FOSSIL_TEST(cpp_test_sort_network_c_array_desc) {
+    uint16_t arr[] = {3, 17, 9, 1, 12, 5, 8};
+    uint16_t expected[] = {17, 12, 9, 8, 5, 3, 1};
+    fossil::algorithm::sort_network(arr, true);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_network_exec_u8) {
+    uint8_t arr[] = {200, 3, 99, 42};
+    uint8_t expected[] = {3, 42, 99, 200};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::network(arr, 4, "u8") == 0);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_static_sort_keyword_table) {
+    constexpr std::array<std::string_view, 5> keywords = fossil::algorithm::static_sort(
+        std::array<std::string_view, 5>{"while", "if", "return", "else", "for"});
+    static_assert(fossil::algorithm::static_is_sorted(keywords), "table must be sorted at compile time");
+    ASSUME_ITS_TRUE(keywords[0] == "else");
+    ASSUME_ITS_TRUE(keywords[4] == "while");
+}
+
+FOSSIL_TEST(cpp_test_sort_static_sort_custom_order) {
+    struct greater {
+        constexpr bool operator()(int a, int b) const { return a > b; }
+    };
+    constexpr auto values = fossil::algorithm::static_sort(std::array<int, 40>{
+        5, 39, 12, 0, 33, 21, 8, 17, 26, 3, 30, 14, 37, 1, 22, 9, 35, 19, 28, 6,
+        11, 24, 2, 38, 15, 31, 7, 20, 27, 4, 36, 13, 25, 10, 32, 18, 29, 16, 34, 23}, greater{});
+    static_assert(values[0] == 39 && values[39] == 0, "descending at compile time");
+    ASSUME_ITS_TRUE(fossil::algorithm::static_is_sorted(values, greater{}));
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_small_auto_u64_desc) {
+    uint64_t arr[48];
+    for (int i = 0; i < 48; ++i)
+        arr[i] = (uint64_t)((i * 29) % 48);
+    int status = fossil::algorithm::Sort::exec(arr, 48, "u64", "auto", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 48; ++i)
+        ASSUME_ITS_TRUE(arr[i] == (uint64_t)(47 - i));
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_small_merge_cstr_stable) {
+    const char *shared = "same";
+    const char *other = "same";
+    const char *arr[] = {"zulu", shared, "alpha", other};
+    int status = fossil::algorithm::Sort::exec(arr, 4, "cstr", "merge", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(strcmp(arr[0], "alpha") == 0);
+    ASSUME_ITS_TRUE(arr[1] == shared && arr[2] == other);
+    ASSUME_ITS_TRUE(strcmp(arr[3], "zulu") == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_i64_quick_organ_pipe_asc) {
+    static int64_t arr[600];
+    for (int i = 0; i < 600; ++i)
+        arr[i] = i < 300 ? i : 599 - i;
+    int status = fossil::algorithm::Sort::exec(arr, 600, "i64", "quick", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 600; ++i)
+        ASSUME_ITS_TRUE(arr[i] == i / 2);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_cstr_quick_desc) {
+    const char *arr[40];
+    const char *words[] = {"kiwi", "apple", "fig", "pear", "banana"};
+    for (int i = 0; i < 40; ++i)
+        arr[i] = words[(i * 3) % 5];
+    int status = fossil::algorithm::Sort::exec(arr, 40, "cstr", "quick", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(strcmp(arr[0], "pear") == 0);
+    ASSUME_ITS_TRUE(strcmp(arr[39], "apple") == 0);
+    for (int i = 1; i < 40; ++i)
+        ASSUME_ITS_TRUE(strcmp(arr[i - 1], arr[i]) >= 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_auto_low_cardinality_f64) {
+    static double arr[2000];
+    for (int i = 0; i < 2000; ++i)
+        arr[i] = (double)((i * 7) % 5) - 2.5;
+    int status = fossil::algorithm::Sort::exec(arr, 2000, "f64", "auto", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 2000; ++i)
+        ASSUME_ITS_TRUE(arr[i] == 1.5 - (double)(i / 400));
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_counting_i8_signed) {
+    int8_t arr[] = {5, -128, 127, -1, 0, -1, 3};
+    int8_t expected[] = {-128, -1, -1, 0, 3, 5, 127};
+    int status = fossil::algorithm::Sort::exec(arr, 7, "i8", "counting", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+    float real[] = {2.0f, 1.0f};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec(real, 2, "f32", "counting", "asc") == -15);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_datetime_narrowed_auto_asc) {
+    static int64_t arr[1000];
+    const int64_t day = INT64_C(1700000000000);
+    for (int i = 0; i < 1000; ++i)
+        arr[i] = day + (int64_t)((i * 7919) % 1000) * 86000;
+    int status = fossil::algorithm::Sort::exec(arr, 1000, "datetime", "auto", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 1000; ++i)
+        ASSUME_ITS_TRUE(arr[i] == day + (int64_t)i * 86000);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_i32_radix_negative_desc) {
+    int32_t arr[] = {-5, 2000000000, 0, -2000000000, 17, -5};
+    int32_t expected[] = {2000000000, 17, 0, -5, -5, -2000000000};
+    int status = fossil::algorithm::Sort::exec(arr, 6, "i32", "radix", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_u32_radix_large_values) {
+    uint32_t arr[] = {4000000000u, 3u, 1000000000u, 4294967295u, 0u};
+    uint32_t expected[] = {0u, 3u, 1000000000u, 4000000000u, 4294967295u};
+    int status = fossil::algorithm::Sort::exec(arr, 5, "u32", "radix", "asc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_u64_counting_small_range) {
+    uint64_t arr[] = {UINT64_C(9000000000000000003), UINT64_C(9000000000000000001),
+                      UINT64_C(9000000000000000002), UINT64_C(9000000000000000001)};
+    int status = fossil::algorithm::Sort::exec(arr, 4, "u64", "counting", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(arr[0] == UINT64_C(9000000000000000003) && arr[3] == UINT64_C(9000000000000000001));
+    uint64_t wide[] = {UINT64_MAX, 0};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec(wide, 2, "u64", "counting", "asc") == -15);
+}
+
+static double cpp_test_sort_uniform_cdf(double value, void *context) {
+    (void)context;
+    return value / 1000.0;
+}
+
+FOSSIL_TEST(cpp_test_sort_flash_custom_cdf_f64) {
+    static double arr[800];
+    for (int i = 0; i < 800; ++i)
+        arr[i] = (double)((i * 347) % 800) * 1.25;
+    int status = fossil::algorithm::Sort::flash(arr, 800, "f64", "asc", cpp_test_sort_uniform_cdf);
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 800; ++i)
+        ASSUME_ITS_TRUE(arr[i] == (double)i * 1.25);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_flash_sampled_i32_desc) {
+    static int32_t arr[500];
+    for (int i = 0; i < 500; ++i)
+        arr[i] = ((i * 211) % 500) * ((i * 211) % 500) - 1000;
+    int status = fossil::algorithm::Sort::exec(arr, 500, "i32", "flash", "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    for (int i = 0; i < 500; ++i)
+        ASSUME_ITS_TRUE(arr[i] == (499 - i) * (499 - i) - 1000);
+}
+
+FOSSIL_TEST(cpp_test_sort_flash_limits) {
+    const char *words[] = {"b", "a"};
+    float one[] = {1.0f};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::flash(words, 2, "cstr") == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::flash(nullptr, 2, "f32") == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::flash(one, 1, "f32") == 0);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec(words, 2, "cstr", "flash", "asc") == -18);
+}
+
+FOSSIL_TEST(cpp_test_sort_partition_radix_i32_payload) {
+    int32_t keys[] = {5, -7, 1 << 30, -(1 << 30), 0, -1, 123};
+    uint16_t rows[] = {0, 1, 2, 3, 4, 5, 6};
+    int32_t out[7];
+    uint16_t rows_out[7];
+    size_t offsets[5];
+    int status = fossil::algorithm::Sort::partition(keys, out, 7, "i32", "radix", 2, 30, offsets, 1,
+                                                    rows, rows_out, sizeof(uint16_t));
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(offsets[0] == 0 && offsets[1] == 0 && offsets[2] == 3 && offsets[3] == 6 && offsets[4] == 7);
+    int32_t expected[] = {-7, -(1 << 30), -1, 5, 0, 123, 1 << 30};
+    uint16_t expected_rows[] = {1, 3, 5, 0, 4, 6, 2};
+    ASSUME_ITS_TRUE(memcmp(out, expected, sizeof(out)) == 0);
+    ASSUME_ITS_TRUE(memcmp(rows_out, expected_rows, sizeof(rows_out)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_partition_hash_threads_stable) {
+    enum { N = 70000, BITS = 6 };
+    static uint64_t keys[N], out[N];
+    static uint32_t rows[N], rows_out[N];
+    static size_t offsets[(1u << BITS) + 1], single[(1u << BITS) + 1];
+    for (uint32_t i = 0; i < N; ++i) {
+        keys[i] = (uint64_t)(i % 1000) * UINT64_C(0x9E3779B97F4A7C15);
+        rows[i] = i;
+    }
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition(keys, out, N, "u64", "hash", BITS, 0, single) == 0);
+    int status = fossil::algorithm::Sort::partition(keys, out, N, "u64", "hash", BITS, 0, offsets, 4,
+                                                    rows, rows_out, sizeof(uint32_t));
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(memcmp(offsets, single, sizeof(offsets)) == 0);
+    ASSUME_ITS_TRUE(offsets[1u << BITS] == N);
+    for (size_t p = 0; p < (1u << BITS); ++p) {
+        for (size_t i = offsets[p]; i < offsets[p + 1]; ++i) {
+            ASSUME_ITS_TRUE(out[i] == keys[rows_out[i]]);
+            if (i > offsets[p])
+                ASSUME_ITS_TRUE(rows_out[i] > rows_out[i - 1]);
+        }
+    }
+}
+
+FOSSIL_TEST(cpp_test_sort_partition_limits) {
+    int32_t keys[] = {1, 2};
+    int32_t out[2];
+    size_t offsets[3];
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition(keys, keys, 2, "i32", "radix", 1, 0, offsets) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition(keys, out, 2, "cstr", "radix", 1, 0, offsets) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition(keys, out, 2, "i32", "range", 1, 0, offsets) == -3);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition(keys, out, 2, "i32", "radix", 17, 0, offsets) == -4);
+}
+
+FOSSIL_TEST(cpp_test_sort_partition_if_lt_stable) {
+    int32_t arr[] = {7, 120, -3, 100, 99, 512, 0, 101};
+    int32_t expected[] = {7, -3, 99, 0, 120, 100, 512, 101};
+    int32_t limit = 100;
+    size_t hits = 0;
+    int status = fossil::algorithm::Sort::partition_if(arr, 8, "i32", "lt", &limit, nullptr, &hits);
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(hits == 4);
+    ASSUME_ITS_TRUE(memcmp(arr, expected, sizeof(arr)) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_filter_range_and_mask) {
+    double arr[] = {0.5, 2.5, 1.0, -1.0, 2.0, 3.0};
+    double out[6];
+    double lo = 1.0, hi = 2.5;
+    size_t hits = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::filter(arr, out, 6, "f64", "range", &lo, &hi, &hits) == 0);
+    ASSUME_ITS_TRUE(hits == 3);
+    ASSUME_ITS_TRUE(out[0] == 2.5 && out[1] == 1.0 && out[2] == 2.0);
+
+    uint8_t bytes[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j'};
+    uint8_t bitmap[] = {0x85, 0x02}; // elements 0, 2, 7 and 9
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::filter(bytes, bytes, 10, "u8", "mask", bitmap, nullptr, &hits) == 0);
+    ASSUME_ITS_TRUE(hits == 4);
+    ASSUME_ITS_TRUE(memcmp(bytes, "achj", 4) == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_filter_limits) {
+    int32_t arr[] = {1, 2};
+    int32_t out[2];
+    int32_t v = 1;
+    const char *words[] = {"a", "b"};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::filter(arr, out, 2, "i32", "eq", nullptr) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::filter(arr, out, 2, "i32", "range", &v) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::filter(words, out, 2, "cstr", "eq", &v) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::partition_if(arr, 2, "i32", "like", &v) == -3);
+}
+
+FOSSIL_TEST(cpp_test_sort_unique_i32) {
+    int32_t arr[] = {-3, -3, 0, 2, 2, 2, 7, 9, 9};
+    int32_t expected[] = {-3, 0, 2, 7, 9};
+    size_t kept = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::unique_count(arr, 9, "i32", &kept) == 0);
+    ASSUME_ITS_TRUE(kept == 5);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::unique(arr, 9, "i32", &kept) == 0);
+    ASSUME_ITS_TRUE(kept == 5);
+    for (size_t i = 0; i < kept; ++i)
+        ASSUME_ITS_TRUE(arr[i] == expected[i]);
+}
+
+FOSSIL_TEST(cpp_test_sort_unique_cstr_desc) {
+    const char *words[] = {"pear", "pear", "fig", "apple", "apple"};
+    size_t kept = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::unique(words, 5, "cstr", &kept) == 0);
+    ASSUME_ITS_TRUE(kept == 3);
+    ASSUME_ITS_TRUE(strcmp(words[0], "pear") == 0);
+    ASSUME_ITS_TRUE(strcmp(words[1], "fig") == 0);
+    ASSUME_ITS_TRUE(strcmp(words[2], "apple") == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_exec_unique_fused_i64) {
+    static int64_t arr[5000];
+    for (size_t i = 0; i < 5000; ++i)
+        arr[i] = (int64_t)((i * 7919u) % 100u) - 50;
+    size_t kept = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec_unique(arr, 5000, "i64", &kept, "auto", "desc") == 0);
+    ASSUME_ITS_TRUE(kept == 100);
+    for (size_t i = 0; i < kept; ++i)
+        ASSUME_ITS_TRUE(arr[i] == 49 - (int64_t)i);
+}
+
+FOSSIL_TEST(cpp_test_sort_rle_round_trip) {
+    uint8_t arr[] = {4, 4, 4, 1, 9, 9, 4};
+    uint8_t values[7];
+    size_t lengths[7];
+    uint8_t back[7];
+    size_t runs = 0, n = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::rle_encode(arr, 7, "u8", nullptr, nullptr, &runs) == 0);
+    ASSUME_ITS_TRUE(runs == 4);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::rle_encode(arr, 7, "u8", values, lengths, &runs) == 0);
+    ASSUME_ITS_TRUE(values[2] == 9);
+    ASSUME_ITS_TRUE(lengths[0] == 3);
+    ASSUME_ITS_TRUE(lengths[2] == 2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::rle_decode(values, lengths, runs, "u8", back, 6, &n) == -4);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::rle_decode(values, lengths, runs, "u8", back, 7, &n) == 0);
+    ASSUME_ITS_TRUE(n == 7);
+    for (size_t i = 0; i < 7; ++i)
+        ASSUME_ITS_TRUE(back[i] == arr[i]);
+}
+
+FOSSIL_TEST(cpp_test_sort_unique_limits) {
+    int32_t arr[] = {1, 1};
+    size_t kept = 0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::unique(arr, 2, "i32", nullptr) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::unique(arr, 2, "bogus", &kept) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::rle_encode(nullptr, 2, "i32", nullptr, nullptr, &kept) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec_unique(arr, 2, "i32", &kept, "bogus") == -3);
+}
+
+FOSSIL_TEST(cpp_test_sort_group_by_i32_sum) {
+    int32_t store[] = {3, 1, 3, 2, 1, 3};
+    double amount[] = {5.0, 2.0, 1.0, 7.0, 4.0, -2.0};
+    int32_t ids[6];
+    fossil_algorithm_sort_group_t aggs[6];
+    size_t groups = 0;
+    int status = fossil::algorithm::Sort::group_by(store, amount, 6, "i32", "f64", ids, aggs, &groups);
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(groups == 3);
+    ASSUME_ITS_TRUE(ids[0] == 1 && ids[1] == 2 && ids[2] == 3);
+    ASSUME_ITS_TRUE(aggs[0].count == 2 && aggs[0].sum == 6.0);
+    ASSUME_ITS_TRUE(aggs[1].min == 7.0 && aggs[1].max == 7.0);
+    ASSUME_ITS_TRUE(aggs[2].count == 3 && aggs[2].sum == 4.0);
+    ASSUME_ITS_TRUE(aggs[2].min == -2.0 && aggs[2].max == 5.0);
+}
+
+FOSSIL_TEST(cpp_test_sort_group_by_u64_partitioned_desc) {
+    static uint64_t keys[9000];
+    static uint16_t values[9000];
+    static uint64_t ids[9000];
+    static fossil_algorithm_sort_group_t aggs[9000];
+    for (size_t i = 0; i < 9000; ++i) {
+        keys[i] = ((uint64_t)(i % 3000) * 0x9E3779B97F4A7C15ULL) >> 8;
+        values[i] = (uint16_t)(i / 3000);
+    }
+    size_t groups = 0;
+    int status = fossil::algorithm::Sort::group_by(keys, values, 9000, "u64", "u16", ids, aggs, &groups, "desc");
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(groups == 3000);
+    for (size_t i = 0; i < groups; ++i) {
+        ASSUME_ITS_TRUE(aggs[i].count == 3 && aggs[i].sum == 3.0);
+        ASSUME_ITS_TRUE(aggs[i].min == 0.0 && aggs[i].max == 2.0);
+        if (i > 0)
+            ASSUME_ITS_TRUE(ids[i - 1] > ids[i]);
+    }
+}
+
+FOSSIL_TEST(cpp_test_sort_group_by_count_only) {
+    static double keys[2000];
+    static double ids[2000];
+    static fossil_algorithm_sort_group_t aggs[2000];
+    for (size_t i = 0; i < 2000; ++i)
+        keys[i] = (double)(i % 5) * 0.5 - 1.0;
+    size_t groups = 0;
+    int status = fossil::algorithm::Sort::group_by(keys, nullptr, 2000, "f64", "", ids, aggs, &groups);
+    ASSUME_ITS_TRUE(status == 0);
+    ASSUME_ITS_TRUE(groups == 5);
+    for (size_t i = 0; i < groups; ++i) {
+        ASSUME_ITS_TRUE(ids[i] == (double)i * 0.5 - 1.0);
+        ASSUME_ITS_TRUE(aggs[i].count == 400 && aggs[i].sum == 0.0);
+    }
+}
+
+FOSSIL_TEST(cpp_test_sort_group_by_limits) {
+    int32_t keys[] = {1, 2};
+    int32_t ids[2];
+    fossil_algorithm_sort_group_t aggs[2];
+    size_t groups = 0;
+    const char *words[] = {"a", "b"};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::group_by(keys, nullptr, 2, "i32", "", nullptr, aggs, &groups) == -1);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::group_by(words, nullptr, 2, "cstr", "", ids, aggs, &groups) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::group_by(keys, words, 2, "i32", "cstr", ids, aggs, &groups) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::group_by(keys, nullptr, 0, "i32", "", ids, aggs, &groups) == 0);
+    ASSUME_ITS_TRUE(groups == 0);
+}
+
+FOSSIL_TEST(cpp_test_sort_select_ranks_i32) {
+    static int32_t arr[5000];
+    for (int i = 0; i < 5000; ++i)
+        arr[i] = (i * 2711) % 5000;
+    size_t ranks[] = {4999, 0, 2500, 123, 2500};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::select(arr, 5000, "i32", ranks, 5) == 0);
+    ASSUME_ITS_TRUE(arr[0] == 0 && arr[123] == 123 && arr[2500] == 2500 && arr[4999] == 4999);
+    for (int i = 0; i < 5000; ++i)
+        ASSUME_ITS_TRUE(i < 2500 ? arr[i] < 2500 : arr[i] >= 2500);
+}
+
+FOSSIL_TEST(cpp_test_sort_select_desc_u16) {
+    uint16_t arr[] = {9, 2, 7, 4, 7, 1, 8};
+    size_t ranks[] = {1, 5};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::select(arr, 7, "u16", ranks, 2, "desc") == 0);
+    ASSUME_ITS_TRUE(arr[1] == 8 && arr[5] == 2);
+}
+
+FOSSIL_TEST(cpp_test_sort_quantiles_copy_and_median) {
+    static uint32_t arr[1000];
+    for (uint32_t i = 0; i < 1000; ++i)
+        arr[i] = (i * 7u) % 1000u + 1u;
+    double qs[] = {0.0, 0.5, 0.95, 1.0};
+    uint32_t out[4];
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::quantiles(arr, 1000, "u32", qs, 4, out) == 0);
+    ASSUME_ITS_TRUE(out[0] == 1 && out[1] == 500 && out[2] == 950 && out[3] == 1000);
+    ASSUME_ITS_TRUE(arr[1] == 8);
+    double values[] = {3.5, -1.0, 8.25, 0.5};
+    double median = 0.0;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::median(values, 4, "f64", &median, true) == 0);
+    ASSUME_ITS_TRUE(median == 0.5);
+}
+
+FOSSIL_TEST(cpp_test_sort_select_limits) {
+    int32_t arr[] = {3, 1, 2};
+    size_t bad_rank = 3;
+    double bad_q = 1.5;
+    int32_t out;
+    const char *words[] = {"b", "a"};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::select(arr, 3, "i32", &bad_rank, 1) == -4);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::select(words, 2, "cstr", &bad_rank, 1) == -2);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::quantiles(arr, 3, "i32", &bad_q, 1, &out) == -4);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::median(arr, 0, "i32", &out) == -4);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::median(nullptr, 3, "i32", &out) == -1);
+}
+
+FOSSIL_TEST(cpp_test_sort_is_sorted_until) {
+    static int32_t arr[100];
+    for (int32_t i = 0; i < 100; ++i)
+        arr[i] = i / 3;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted(arr, 100, "i32"));
+    ASSUME_ITS_TRUE(!fossil::algorithm::Sort::is_sorted(arr, 100, "i32", "desc"));
+    arr[70] = -1;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted_until(arr, 100, "i32") == 70);
+    const char *words[] = {"pear", "kiwi", "kiwi", "apple"};
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted(words, 4, "cstr", "desc"));
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted_until(words, 4, "cstr") == 1);
+}
+
+FOSSIL_TEST(cpp_test_sort_presortedness) {
+    static double arr[1000];
+    for (int i = 0; i < 1000; ++i)
+        arr[i] = (double)(1000 - i);
+    fossil_algorithm_sort_sortedness_t m;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::presortedness(arr, 1000, "f64", m) == 0);
+    ASSUME_ITS_TRUE(m.sorted_prefix == 1 && m.runs == 1000 && m.inversion_ratio == 1.0);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::presortedness(arr, 1000, "f64", m, "desc") == 0);
+    ASSUME_ITS_TRUE(m.sorted_prefix == 1000 && m.runs == 1 && m.inversion_ratio == 0.0);
+}
+
+FOSSIL_TEST(cpp_test_sort_auto_presorted_inputs) {
+    static uint32_t arr[5000];
+    for (uint32_t i = 0; i < 5000; ++i)
+        arr[i] = 5000u - i;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec(arr, 5000, "u32", "auto", "asc") == 0);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted(arr, 5000, "u32") && arr[0] == 1);
+    for (uint32_t i = 0; i < 5000; ++i)
+        arr[i] = i < 4700 ? i * 2u : (i * 7919u) % 9400u;
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::exec(arr, 5000, "u32", "auto", "desc") == 0);
+    ASSUME_ITS_TRUE(fossil::algorithm::Sort::is_sorted(arr, 5000, "u32", "desc"));
+}
+
 // * * * * * * * * * * * * * * * * * * * * * * * *
 // * Fossil Logic Test Pool
 // * * * * * * * * * * * * * * * * * * * * * * * *
@@ -161,6 +669,50 @@ FOSSIL_TEST_GROUP(cpp_sort_tests) {
     FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_f32_merge_desc);
     FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_already_sorted_asc);
     FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_reverse_sorted_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_i32_heap_duplicates_asc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_cstr_heap_asc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_i32_shell_large_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_cstr_shell_asc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_network_constexpr_array);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_network_c_array_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_network_exec_u8);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_static_sort_keyword_table);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_static_sort_custom_order);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_small_auto_u64_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_small_merge_cstr_stable);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_i64_quick_organ_pipe_asc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_cstr_quick_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_auto_low_cardinality_f64);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_counting_i8_signed);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_datetime_narrowed_auto_asc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_i32_radix_negative_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_u32_radix_large_values);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_u64_counting_small_range);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_flash_custom_cdf_f64);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_flash_sampled_i32_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_flash_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_partition_radix_i32_payload);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_partition_hash_threads_stable);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_partition_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_partition_if_lt_stable);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_filter_range_and_mask);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_filter_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_unique_i32);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_unique_cstr_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_exec_unique_fused_i64);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_rle_round_trip);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_unique_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_group_by_i32_sum);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_group_by_u64_partitioned_desc);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_group_by_count_only);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_group_by_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_select_ranks_i32);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_select_desc_u16);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_quantiles_copy_and_median);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_select_limits);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_is_sorted_until);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_presortedness);
+    FOSSIL_TEST_ADD(cpp_algorithm_sort_fixture, cpp_test_sort_auto_presorted_inputs);
 
     FOSSIL_TEST_REGISTER(cpp_algorithm_sort_fixture);
 } // end of tests